@@ -0,0 +1,477 @@
+/**
+ * @file bench.c
+ * @brief Mesure des performances de la lecture, des méthodes de vote et des primitives de graphe.
+ * @author Bibyk Bogdan
+ * @date 18 octobre 2026
+ *
+ * Ce programme génère des élections avec bin/gen_ballots pour chaque taille demandée (votants x
+ * candidats), puis mesure plusieurs fois chaque étape : lecture du CSV, structures partagées, chaque
+ * fonction vote*, isCycled et sortedMatrixValues. La médiane et le 95e centile de chaque mesure sont
+ * écrits en JSON (un objet par ligne), et comparés à un fichier de référence du même format.
+ *
+ * Au-delà d'une trentaine de candidats, l'en-tête des bulletins dépasse la limite de lecture_csv.c :
+ * l'élection est alors lue depuis sa matrice des duels, et seules les méthodes Condorcet et les
+ * primitives de graphe sont mesurées.
+ *
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <unistd.h>
+#include "../lecture_csv.h"
+#include "../lecture_duels.h"
+#include "../candidats.h"
+#include "../duels.h"
+#include "../graph.h"
+#include "../positionnel.h"
+#include "../uninominales.h"
+#include "../condorcet.h"
+#include "../jugement_majoritaire.h"
+#include "../stv.h"
+#include "../statistiques.h"
+
+/**
+ * @def MAX_TAILLES
+ * @brief Nombre maximal de valeurs par dimension de la grille.
+ */
+#define MAX_TAILLES 16
+
+/**
+ * @def MAX_REPETITIONS
+ * @brief Nombre maximal de répétitions d'une mesure.
+ */
+#define MAX_REPETITIONS 101
+
+/**
+ * @def MAX_MESURES
+ * @brief Nombre maximal de mesures d'un fichier de référence.
+ */
+#define MAX_MESURES 4096
+
+/**
+ * @def LIGNE_MAX_LECTURE
+ * @brief Longueur de ligne maximale acceptée par lecture_csv.c (MAXCHAR).
+ */
+#define LIGNE_MAX_LECTURE 1024
+
+/**
+ * @struct Mesure
+ * @brief Résultat d'une mesure, ou d'une mesure de référence.
+ */
+typedef struct Mesure
+{
+    char nom[64];      ///< Étape mesurée.
+    long long votants; ///< Nombre de votants.
+    int candidats;     ///< Nombre de candidats.
+    int repetitions;   ///< Nombre de répétitions.
+    double mediane;    ///< Durée médiane en millisecondes.
+    double p95;        ///< 95e centile en millisecondes.
+} Mesure;
+
+/**
+ * @struct Banc
+ * @brief Paramètres et résultats du banc de mesure.
+ */
+typedef struct Banc
+{
+    int repetitions;          ///< Nombre de répétitions de chaque mesure.
+    char *generateur;         ///< Chemin de gen_ballots.
+    char repertoire[64];      ///< Répertoire temporaire des élections générées.
+    Mesure *mesures;          ///< Mesures effectuées.
+    int nbMesures;            ///< Nombre de mesures effectuées.
+    long long votants;        ///< Taille en cours.
+    int candidats;            ///< Taille en cours.
+} Banc;
+
+/**
+ * @def MESURER(banc, nom, preparation, instruction, nettoyage)
+ * @brief Répète une instruction et enregistre sa médiane et son 95e centile.
+ *
+ * Seule l'instruction est chronométrée : la préparation et le nettoyage l'entourent à chaque répétition.
+ */
+#define MESURER(banc, nom, preparation, instruction, nettoyage)  \
+    do                                                           \
+    {                                                            \
+        double durees[MAX_REPETITIONS];                          \
+        for (int r = 0; r < (banc)->repetitions; r++)            \
+        {                                                        \
+            preparation;                                         \
+            uint64_t debut = instantNs();                        \
+            instruction;                                         \
+            durees[r] = (instantNs() - debut) / 1e6;             \
+            nettoyage;                                           \
+        }                                                        \
+        enregistrerMesure((banc), (nom), durees);                \
+    } while (0)
+
+/**
+ * @fn static int comparerDurees(const void *a, const void *b)
+ * @brief Comparaison de deux durées pour qsort.
+ */
+static int comparerDurees(const void *a, const void *b)
+{
+    double x = *(const double *)a;
+    double y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * @fn static void enregistrerMesure(Banc *banc, const char *nom, double *durees)
+ * @brief Calcule la médiane et le 95e centile (rang le plus proche) d'une série de durées.
+ * @param[in, out] banc Banc de mesure.
+ * @param[in] nom Étape mesurée.
+ * @param[in, out] durees Durées en millisecondes (triées par la fonction).
+ */
+static void enregistrerMesure(Banc *banc, const char *nom, double *durees)
+{
+    int n = banc->repetitions;
+    qsort(durees, n, sizeof(double), comparerDurees);
+    Mesure *m = &banc->mesures[banc->nbMesures++];
+    snprintf(m->nom, sizeof(m->nom), "%s", nom);
+    m->votants = banc->votants;
+    m->candidats = banc->candidats;
+    m->repetitions = n;
+    m->mediane = n % 2 ? durees[n / 2] : (durees[n / 2 - 1] + durees[n / 2]) / 2;
+    int rang = (95 * n + 99) / 100;
+    m->p95 = durees[rang - 1];
+    fprintf(stderr, "  %-20s %12.4f ms  (p95 %.4f ms)\n", m->nom, m->mediane, m->p95);
+}
+
+/**
+ * @fn static bool lisibleParScrutin(int nbCandidats)
+ * @brief Indique si l'en-tête et les lignes de bulletins tiennent dans la limite de lecture_csv.c.
+ * @param[in] nbCandidats Nombre de candidats.
+ * @return true si le fichier de bulletins peut être lu par scrutin.
+ */
+static bool lisibleParScrutin(int nbCandidats)
+{
+    // En-tête : colonnes fixes, puis ",Q00_Vote->N - Candidat N" par candidat
+    // Bulletin : numéro, date, cours et empreinte, puis ",rang" par candidat
+    long long entete = strlen("Réponse,Soumis le :,Cours,Nom complet");
+    long long ligne = 20 + 21 + 21 + 65;
+    for (int a = 1; a <= nbCandidats; a++)
+    {
+        int chiffres = snprintf(NULL, 0, "%d", a);
+        entete += 23 + 2 * chiffres;
+        ligne += 1 + snprintf(NULL, 0, "%d", nbCandidats);
+    }
+    return entete < LIGNE_MAX_LECTURE && ligne < LIGNE_MAX_LECTURE;
+}
+
+/**
+ * @fn static void generer(Banc *banc, bool duels, char *chemin)
+ * @brief Génère l'élection de la taille en cours avec gen_ballots.
+ * @param[in] banc Banc de mesure.
+ * @param[in] duels Génération de la matrice des duels plutôt que des bulletins.
+ * @param[out] chemin Chemin du fichier généré (MAXCHAR caractères).
+ */
+static void generer(Banc *banc, bool duels, char *chemin)
+{
+    snprintf(chemin, MAXCHAR, "%s/election_%lld_%d%s.csv", banc->repertoire, banc->votants, banc->candidats, duels ? "_duels" : "");
+    char commande[3 * MAXCHAR];
+    snprintf(commande, sizeof(commande), "%s -c %d -v %lld -a 0.05 -s 1 %s -o %s", banc->generateur, banc->candidats,
+             banc->votants, duels ? "-d" : "", chemin);
+    if (system(commande) != 0)
+    {
+        fprintf(stderr, "Échec de la génération : %s\n", commande);
+        exit(EXIT_FAILURE);
+    }
+}
+
+/**
+ * @fn static Graph *grapheDesDuels(DuelMatrix *duels, CandidateTable *candidates)
+ * @brief Graphe des marges positives, comme celui de la méthode des paires.
+ */
+static Graph *grapheDesDuels(DuelMatrix *duels, CandidateTable *candidates)
+{
+    Graph *graph = createGraph(duels->nb_candidates, candidates->names);
+    for (int i = 0; i < duels->nb_candidates; i++)
+        for (int j = 0; j < duels->nb_candidates; j++)
+            if (i != j && DUEL_MARGIN(duels, i, j) > 0)
+                setEdge(graph, i, j, DUEL_MARGIN(duels, i, j));
+    return graph;
+}
+
+/**
+ * @fn static void mesurerCondorcet(Banc *banc, DuelMatrix *duels, CandidateTable *candidates)
+ * @brief Mesure les méthodes Condorcet et les primitives de graphe sur une matrice des duels.
+ */
+static void mesurerCondorcet(Banc *banc, DuelMatrix *duels, CandidateTable *candidates)
+{
+    VoteResult variantes[NB_VARIANTES_MINIMAX];
+    MESURER(banc, "cm", , voteCondorcetMinimaxVariantes(duels, candidates, NULL, false, variantes), );
+    MESURER(banc, "cp", , voteCondorcetPairesDuels(duels, candidates, NULL, false), );
+    MESURER(banc, "cs", , voteCondorcetSchulzeDuels(duels, candidates, NULL, false), );
+
+    Graph *graph = grapheDesDuels(duels, candidates);
+    int *valeurs;
+    int *coordonnees;
+    MESURER(banc, "isCycled", , isCycled(graph), );
+    MESURER(banc, "sortedMatrixValues", , sortedMatrixValues(graph, &valeurs, &coordonnees), free(valeurs); free(coordonnees));
+    deleteGraph(graph);
+}
+
+/**
+ * @fn static void echecLecture(void)
+ * @brief Arrête le banc si un fichier généré n'a pas pu être lu.
+ */
+static void echecLecture(void)
+{
+    fprintf(stderr, "Erreur : %s.\n", erreurLecture());
+    exit(EXIT_FAILURE);
+}
+
+/**
+ * @fn static void mesurerBulletins(Banc *banc)
+ * @brief Mesure toutes les étapes sur un fichier de bulletins de la taille en cours.
+ */
+static void mesurerBulletins(Banc *banc)
+{
+    char chemin[MAXCHAR];
+    generer(banc, false, chemin);
+
+    DataFrame *df = NULL;
+    MESURER(banc, "lecture_csv", , df = createDataFrameFromCsv(chemin), if (r < banc->repetitions - 1) freeDataFrame(df));
+    if (df == NULL)
+        echecLecture();
+    CandidateTable *candidates = createCandidateTable(df, false);
+    int nbSieges = banc->candidats > 2 ? 2 : 1;
+
+    // Structures partagées
+    DuelMatrix *duels = NULL;
+    DuelMatrix *depouillement = NULL;
+    Histogramme *histo = NULL;
+    int premieresPlaces[banc->candidats + 1];
+    MESURER(banc, "duels", , duels = createDuelMatrixFromDf(df, candidates, false), if (r < banc->repetitions - 1) deleteDuelMatrix(duels));
+    MESURER(banc, "comptage", , depouillement = tallyBallots(df, candidates, premieresPlaces), if (r < banc->repetitions - 1) deleteDuelMatrix(depouillement));
+    MESURER(banc, "histogramme", , histo = createHistogramme(df, candidates), if (r < banc->repetitions - 1) deleteHistogramme(histo));
+
+    // Méthodes sur les bulletins
+    VoteResult premier, second, tour2;
+    bool majorite;
+    VoteResult elus[nbSieges];
+    int tour;
+    MESURER(banc, "uni1", , voteUninominalUnTour(df, candidates, NULL, false, -1), );
+    MESURER(banc, "uni2", , voteUninominalDeuxToursDuels(depouillement, premieresPlaces, candidates, NULL, false, &premier, &second, &tour2, &majorite), );
+    MESURER(banc, "jm", , voteJugementMajoritaire(df, candidates, echelleMentions(6), NULL, false), );
+    MESURER(banc, "irv", , voteAlternatif(df, candidates, NULL, false), );
+    MESURER(banc, "stv", , voteUniqueTransferable(df, candidates, nbSieges, NULL, false, elus), );
+    MESURER(banc, "borda", , voteBorda(histo, candidates, NULL, false), );
+    MESURER(banc, "dowdall", , voteDowdall(histo, candidates, NULL, false), );
+    MESURER(banc, "anti", , voteAntiPluralite(histo, candidates, NULL, false), );
+    MESURER(banc, "bucklin", , voteBucklin(histo, candidates, NULL, false, &tour), );
+    mesurerCondorcet(banc, duels, candidates);
+
+    deleteHistogramme(histo);
+    deleteDuelMatrix(depouillement);
+    deleteDuelMatrix(duels);
+    deleteCandidateTable(candidates);
+    freeDataFrame(df);
+    remove(chemin);
+}
+
+/**
+ * @fn static void mesurerDuels(Banc *banc)
+ * @brief Mesure les méthodes Condorcet sur une matrice des duels de la taille en cours.
+ */
+static void mesurerDuels(Banc *banc)
+{
+    char chemin[MAXCHAR];
+    generer(banc, true, chemin);
+
+    char **noms = NULL;
+    DuelMatrix *duels = NULL;
+    MESURER(banc, "lecture_duels", , duels = readDuelMatrixCsv(chemin, &noms),
+            if (r < banc->repetitions - 1) { deleteDuelMatrix(duels); freeDuelNames(noms, banc->candidats); });
+    if (duels == NULL)
+        echecLecture();
+    CandidateTable *candidates = createCandidateTableFromNames(noms, duels->nb_candidates);
+    mesurerCondorcet(banc, duels, candidates);
+
+    deleteCandidateTable(candidates);
+    freeDuelNames(noms, banc->candidats);
+    deleteDuelMatrix(duels);
+    remove(chemin);
+}
+
+/**
+ * @fn static int lireTailles(char *liste, long long *tailles)
+ * @brief Lit une liste de tailles séparées par des virgules (notation 1e6 acceptée).
+ * @return Nombre de tailles.
+ */
+static int lireTailles(char *liste, long long *tailles)
+{
+    int n = 0;
+    char *position;
+    for (char *jeton = strtok_r(liste, ",", &position); jeton != NULL && n < MAX_TAILLES; jeton = strtok_r(NULL, ",", &position))
+        tailles[n++] = (long long)atof(jeton);
+    return n;
+}
+
+/**
+ * @fn static void ecrireMesures(Banc *banc, char *chemin)
+ * @brief Écrit les mesures en JSON, un objet par ligne.
+ */
+static void ecrireMesures(Banc *banc, char *chemin)
+{
+    FILE *fp = fopen(chemin, "w");
+    if (fp == NULL)
+    {
+        perror("fopen");
+        exit(EXIT_FAILURE);
+    }
+    fprintf(fp, "[\n");
+    for (int i = 0; i < banc->nbMesures; i++)
+    {
+        Mesure *m = &banc->mesures[i];
+        fprintf(fp, "{\"mesure\": \"%s\", \"votants\": %lld, \"candidats\": %d, \"repetitions\": %d, \"mediane_ms\": %.6f, \"p95_ms\": %.6f}%s\n",
+                m->nom, m->votants, m->candidats, m->repetitions, m->mediane, m->p95, i < banc->nbMesures - 1 ? "," : "");
+    }
+    fprintf(fp, "]\n");
+    fclose(fp);
+}
+
+/**
+ * @fn static int comparerReference(Banc *banc, char *chemin, double seuil)
+ * @brief Compare les médianes à celles d'un fichier de référence écrit par ecrireMesures.
+ * @param[in] banc Banc de mesure.
+ * @param[in] chemin Fichier de référence.
+ * @param[in] seuil Rapport au-delà duquel une médiane est une régression.
+ * @return Nombre de régressions.
+ */
+static int comparerReference(Banc *banc, char *chemin, double seuil)
+{
+    FILE *fp = fopen(chemin, "r");
+    if (fp == NULL)
+    {
+        fprintf(stderr, "Pas de référence %s (make bench-reference pour l'enregistrer)\n", chemin);
+        return 0;
+    }
+    Mesure *reference = malloc(MAX_MESURES * sizeof(Mesure));
+    if (reference == NULL)
+    {
+        perror("Erreur d'allocation mémoire");
+        exit(EXIT_FAILURE);
+    }
+    int nbReference = 0;
+    char ligne[MAXCHAR];
+    while (fgets(ligne, MAXCHAR, fp) != NULL && nbReference < MAX_MESURES)
+    {
+        Mesure *m = &reference[nbReference];
+        if (sscanf(ligne, "{\"mesure\": \"%63[^\"]\", \"votants\": %lld, \"candidats\": %d, \"repetitions\": %d, \"mediane_ms\": %lf, \"p95_ms\": %lf",
+                   m->nom, &m->votants, &m->candidats, &m->repetitions, &m->mediane, &m->p95) == 6)
+            nbReference++;
+    }
+    fclose(fp);
+
+    // Les écarts de moins de 50 µs sont du bruit de mesure, quel que soit le rapport
+    int nbRegressions = 0;
+    fprintf(stderr, "Comparaison avec %s (seuil x%.2f) :\n", chemin, seuil);
+    for (int i = 0; i < banc->nbMesures; i++)
+    {
+        Mesure *m = &banc->mesures[i];
+        for (int j = 0; j < nbReference; j++)
+        {
+            Mesure *ref = &reference[j];
+            if (strcmp(ref->nom, m->nom) != 0 || ref->votants != m->votants || ref->candidats != m->candidats)
+                continue;
+            double rapport = ref->mediane > 0 ? m->mediane / ref->mediane : 1;
+            bool regression = rapport > seuil && m->mediane - ref->mediane > 0.05;
+            nbRegressions += regression;
+            fprintf(stderr, "  %-20s V=%-9lld C=%-4d %10.4f -> %10.4f ms  x%.2f%s\n", m->nom, m->votants, m->candidats,
+                    ref->mediane, m->mediane, rapport, regression ? "  RÉGRESSION" : "");
+            break;
+        }
+    }
+    free(reference);
+    return nbRegressions;
+}
+
+/**
+ * @fn static void usage(void)
+ * @brief Affiche l'usage du programme et termine.
+ */
+static void usage(void)
+{
+    fprintf(stderr, "Usage: bench [-v votants,...] [-c candidats,...] [-r répétitions] [-o résultats.json]\n");
+    fprintf(stderr, "             [-b référence.json] [-t seuil] [-G gen_ballots]\n");
+    exit(EXIT_FAILURE);
+}
+
+int main(int argc, char *argv[])
+{
+    char listeVotants[MAXCHAR] = "1000,10000,100000";
+    char listeCandidats[MAXCHAR] = "3,10,50";
+    char *sortie = "bench/resultats.json";
+    char *reference = NULL;
+    double seuil = 1.15;
+    Banc banc = {7, "bin/gen_ballots", "", NULL, 0, 0, 0};
+
+    int option;
+    while ((option = getopt(argc, argv, "v:c:r:o:b:t:G:")) != -1)
+    {
+        switch (option)
+        {
+        case 'v':
+            snprintf(listeVotants, MAXCHAR, "%s", optarg);
+            break;
+        case 'c':
+            snprintf(listeCandidats, MAXCHAR, "%s", optarg);
+            break;
+        case 'r':
+            banc.repetitions = atoi(optarg);
+            break;
+        case 'o':
+            sortie = optarg;
+            break;
+        case 'b':
+            reference = optarg;
+            break;
+        case 't':
+            seuil = atof(optarg);
+            break;
+        case 'G':
+            banc.generateur = optarg;
+            break;
+        default:
+            usage();
+        }
+    }
+    if (banc.repetitions < 1 || banc.repetitions > MAX_REPETITIONS)
+        usage();
+
+    long long votants[MAX_TAILLES];
+    long long candidats[MAX_TAILLES];
+    int nbVotants = lireTailles(listeVotants, votants);
+    int nbCandidats = lireTailles(listeCandidats, candidats);
+    banc.mesures = malloc(MAX_MESURES * sizeof(Mesure));
+    snprintf(banc.repertoire, sizeof(banc.repertoire), "/tmp/bench_scrutinXXXXXX");
+    if (banc.mesures == NULL || mkdtemp(banc.repertoire) == NULL)
+    {
+        perror("Préparation du banc");
+        exit(EXIT_FAILURE);
+    }
+
+    for (int c = 0; c < nbCandidats; c++)
+    {
+        for (int v = 0; v < nbVotants; v++)
+        {
+            banc.votants = votants[v];
+            banc.candidats = (int)candidats[c];
+            bool lisible = lisibleParScrutin(banc.candidats);
+            fprintf(stderr, "V = %lld, C = %d%s\n", banc.votants, banc.candidats, lisible ? "" : " (matrice des duels)");
+            if (lisible)
+                mesurerBulletins(&banc);
+            else
+                mesurerDuels(&banc);
+        }
+    }
+    rmdir(banc.repertoire);
+
+    ecrireMesures(&banc, sortie);
+    int nbRegressions = reference != NULL ? comparerReference(&banc, reference, seuil) : 0;
+    free(banc.mesures);
+    return nbRegressions == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,138 @@
+/**
+ * @file candidats.c
+ * @brief Table des candidats partagée par toutes les méthodes de vote.
+ * @author Bibyk Bogdan
+ * @date 18 octobre 2026
+ *
+ * Ce fichier contient l'implémentation de la table des candidats.
+ * Elle est construite une seule fois au chargement, les méthodes de vote
+ * ne manipulent ensuite que des identifiants entiers.
+ *
+ */
+
+#ifndef CANDIDATS_C
+#define CANDIDATS_C
+
+#include "candidats.h"
+
+#define CANDIDATE_LETTERS "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
+
+/**
+ * @fn static void *allocCandidateMem(size_t size)
+ * @brief Fonction d'allocation mémoire avec arrêt du programme en cas d'échec.
+ * @param[in] size Taille à allouer.
+ * @return Pointeur vers la mémoire allouée.
+ */
+static void *allocCandidateMem(size_t size)
+{
+    void *ptr = malloc(size);
+    if (ptr == NULL)
+    {
+        perror("Erreur d'allocation mémoire");
+        exit(EXIT_FAILURE);
+    }
+    return ptr;
+}
+
+/**
+ * @fn CandidateTable *createCandidateTable(DataFrame *df, bool duel)
+ * @brief Fonction de création de la table des candidats à partir d'un DataFrame.
+ * @param[in] df DataFrame contenant les votes ou la matrice de duels.
+ * @param[in] duel Indique si le DataFrame est une matrice de duels.
+ * @return Table des candidats.
+ *
+ * @details Pour une matrice de duels, chaque colonne est un candidat.
+ *          Pour un fichier de votes, les candidats sont les colonnes entières qui suivent la colonne d'index.
+ */
+CandidateTable *createCandidateTable(DataFrame *df, bool duel)
+{
+    CandidateTable *candidates = allocCandidateMem(sizeof(CandidateTable));
+    candidates->names = allocCandidateMem((df->num_columns + 1) * sizeof(char *));
+    candidates->columns = allocCandidateMem((df->num_columns + 1) * sizeof(int));
+    candidates->letters = allocCandidateMem((df->num_columns + 1) * sizeof(char));
+
+    int nb_candidates = 0;
+    for (int j = duel ? 0 : 1; j < df->num_columns; j++)
+    {
+        if (!duel && df->columns[j].ctype != INT)
+            continue;
+        candidates->names[nb_candidates] = df->columns[j].name;
+        candidates->columns[nb_candidates] = j;
+        candidates->letters[nb_candidates] = nb_candidates < (int)strlen(CANDIDATE_LETTERS)
+                                                 ? CANDIDATE_LETTERS[nb_candidates]
+                                                 : '#';
+        nb_candidates++;
+    }
+    candidates->nb_candidates = nb_candidates;
+    return candidates;
+}
+
+/**
+ * @fn CandidateTable *createCandidateTableFromNames(char **names, int nb_candidates)
+ * @brief Fonction de création de la table des candidats à partir d'une liste de noms.
+ * @param[in] names Noms des candidats.
+ * @param[in] nb_candidates Nombre de candidats.
+ * @return Table des candidats, le candidat i correspondant à la colonne i.
+ */
+CandidateTable *createCandidateTableFromNames(char **names, int nb_candidates)
+{
+    CandidateTable *candidates = allocCandidateMem(sizeof(CandidateTable));
+    candidates->names = allocCandidateMem((nb_candidates + 1) * sizeof(char *));
+    candidates->columns = allocCandidateMem((nb_candidates + 1) * sizeof(int));
+    candidates->letters = allocCandidateMem((nb_candidates + 1) * sizeof(char));
+
+    for (int i = 0; i < nb_candidates; i++)
+    {
+        candidates->names[i] = names[i];
+        candidates->columns[i] = i;
+        candidates->letters[i] = i < (int)strlen(CANDIDATE_LETTERS) ? CANDIDATE_LETTERS[i] : '#';
+    }
+    candidates->nb_candidates = nb_candidates;
+    return candidates;
+}
+
+/**
+ * @fn int findCandidate(CandidateTable *candidates, char *name)
+ * @brief Fonction de recherche d'un candidat par son nom.
+ * @param[in] candidates Table des candidats.
+ * @param[in] name Nom du candidat.
+ * @return Identifiant du candidat, -1 s'il n'existe pas.
+ */
+int findCandidate(CandidateTable *candidates, char *name)
+{
+    for (int i = 0; i < candidates->nb_candidates; i++)
+    {
+        if (strcmp(candidates->names[i], name) == 0)
+            return i;
+    }
+    return -1;
+}
+
+/**
+ * @fn char *candidateName(CandidateTable *candidates, int id)
+ * @brief Fonction de résolution du nom d'un candidat.
+ * @param[in] candidates Table des candidats.
+ * @param[in] id Identifiant du candidat.
+ * @return Nom du candidat, "aucun" si l'identifiant n'est pas valide.
+ */
+char *candidateName(CandidateTable *candidates, int id)
+{
+    if (candidates == NULL || id < 0 || id >= candidates->nb_candidates)
+        return "aucun";
+    return candidates->names[id];
+}
+
+/**
+ * @fn void deleteCandidateTable(CandidateTable *candidates)
+ * @brief Fonction de libération de la table des candidats.
+ * @param[in] candidates Table des candidats.
+ */
+void deleteCandidateTable(CandidateTable *candidates)
+{
+    free(candidates->names);
+    free(candidates->columns);
+    free(candidates->letters);
+    free(candidates);
+}
+
+#endif // CANDIDATS_C
@@ -0,0 +1,81 @@
+/**
+ * @file candidats.h
+ * @brief Table des candidats partagée par toutes les méthodes de vote.
+ * @author Bibyk Bogdan
+ * @date 18 octobre 2026
+ *
+ * Ce fichier d'en-tête définit la table des candidats créée au chargement du fichier de votes.
+ * Chaque candidat est identifié par un entier dense (0 à nb_candidates - 1),
+ * les noms ne sont résolus qu'au moment de l'affichage.
+ *
+ */
+
+#ifndef CANDIDATS_H
+#define CANDIDATS_H
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include "lecture_csv.h"
+
+/**
+ * @struct CandidateTable
+ * @brief Table des candidats : identifiant -> nom, colonne du DataFrame et lettre d'affichage.
+ */
+typedef struct CandidateTable
+{
+    int nb_candidates; ///< Nombre de candidats.
+    char **names;      ///< Nom de chaque candidat (pointe vers le nom de colonne du DataFrame).
+    int *columns;      ///< Indice de la colonne du candidat dans le DataFrame.
+    char *letters;     ///< Lettre d'affichage de chaque candidat.
+} CandidateTable;
+
+/**
+ * @fn CandidateTable *createCandidateTable(DataFrame *df, bool duel)
+ * @brief Fonction de création de la table des candidats à partir d'un DataFrame.
+ * @param[in] df DataFrame contenant les votes ou la matrice de duels.
+ * @param[in] duel Indique si le DataFrame est une matrice de duels.
+ * @return Table des candidats.
+ *
+ * @note Les noms ne sont pas copiés, le DataFrame doit survivre à la table.
+ */
+CandidateTable *createCandidateTable(DataFrame *df, bool duel);
+
+/**
+ * @fn CandidateTable *createCandidateTableFromNames(char **names, int nb_candidates)
+ * @brief Fonction de création de la table des candidats à partir d'une liste de noms.
+ * @param[in] names Noms des candidats.
+ * @param[in] nb_candidates Nombre de candidats.
+ * @return Table des candidats, le candidat i correspondant à la colonne i.
+ *
+ * @note Les noms ne sont pas copiés, ils doivent survivre à la table.
+ */
+CandidateTable *createCandidateTableFromNames(char **names, int nb_candidates);
+
+/**
+ * @fn int findCandidate(CandidateTable *candidates, char *name)
+ * @brief Fonction de recherche d'un candidat par son nom.
+ * @param[in] candidates Table des candidats.
+ * @param[in] name Nom du candidat.
+ * @return Identifiant du candidat, -1 s'il n'existe pas.
+ */
+int findCandidate(CandidateTable *candidates, char *name);
+
+/**
+ * @fn char *candidateName(CandidateTable *candidates, int id)
+ * @brief Fonction de résolution du nom d'un candidat.
+ * @param[in] candidates Table des candidats.
+ * @param[in] id Identifiant du candidat.
+ * @return Nom du candidat, "aucun" si l'identifiant n'est pas valide.
+ */
+char *candidateName(CandidateTable *candidates, int id);
+
+/**
+ * @fn void deleteCandidateTable(CandidateTable *candidates)
+ * @brief Fonction de libération de la table des candidats.
+ * @param[in] candidates Table des candidats.
+ */
+void deleteCandidateTable(CandidateTable *candidates);
+
+#endif
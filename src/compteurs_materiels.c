@@ -0,0 +1,163 @@
+/**
+ * @file compteurs_materiels.c
+ * @brief Compteurs matériels du processeur (cycles, instructions, défauts de cache et de prédiction).
+ * @author Bibyk Bogdan
+ * @date 18 octobre 2026
+ *
+ * Ce fichier contient l'implémentation des compteurs matériels. Les événements sont ouverts un par
+ * un plutôt qu'en groupe : un événement absent (fréquent en machine virtuelle) n'empêche pas de
+ * compter les autres.
+ *
+ */
+
+#ifndef COMPTEURS_MATERIELS_C
+#define COMPTEURS_MATERIELS_C
+
+#include <string.h>
+#include <errno.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "compteurs_materiels.h"
+
+#ifdef __linux__
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#endif
+
+/// Événements disponibles, déterminés à l'activation.
+static bool disponibles[NB_EVENEMENTS];
+/// Indique si les compteurs ont été activés.
+static bool actifs = false;
+/// Descripteurs des compteurs du thread, -1 si non ouverts.
+static _Thread_local int descripteurs[NB_EVENEMENTS];
+/// Indique si le thread a déjà ouvert ses compteurs.
+static _Thread_local bool ouverts = false;
+/// Clé de fermeture des compteurs à la fin d'un thread.
+static pthread_key_t cleFermeture;
+
+#ifdef __linux__
+/// Configuration perf de chaque événement, dans l'ordre de l'énumération.
+static const uint64_t configurations[NB_EVENEMENTS] = {
+    PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES};
+
+/**
+ * @fn static int ouvrirEvenement(EvenementMateriel evenement)
+ * @brief Ouvre un compteur pour le thread appelant, côté utilisateur seulement.
+ * @param[in] evenement Événement.
+ * @return Descripteur, -1 en cas d'échec (errno renseigné).
+ */
+static int ouvrirEvenement(EvenementMateriel evenement)
+{
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = configurations[evenement];
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    return (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+}
+#else
+static int ouvrirEvenement(EvenementMateriel evenement)
+{
+    (void)evenement;
+    errno = ENOSYS;
+    return -1;
+}
+#endif
+
+/**
+ * @fn static void fermerCompteurs(void *arg)
+ * @brief Ferme les compteurs d'un thread qui se termine.
+ * @param[in] arg Valeur de la clé (inutilisée).
+ */
+static void fermerCompteurs(void *arg)
+{
+    (void)arg;
+    for (int e = 0; e < NB_EVENEMENTS; e++)
+    {
+        if (descripteurs[e] >= 0)
+            close(descripteurs[e]);
+        descripteurs[e] = -1;
+    }
+}
+
+/**
+ * @fn static void ouvrirCompteursThread(void)
+ * @brief Ouvre les compteurs disponibles pour le thread appelant.
+ */
+static void ouvrirCompteursThread(void)
+{
+    for (int e = 0; e < NB_EVENEMENTS; e++)
+        descripteurs[e] = disponibles[e] ? ouvrirEvenement(e) : -1;
+    ouverts = true;
+    pthread_setspecific(cleFermeture, descripteurs);
+}
+
+/**
+ * @fn int activerCompteursMateriels(FILE *erreurs)
+ * @brief Vérifie la disponibilité des compteurs et active leur lecture.
+ * @param[out] erreurs Fichier où signaler les compteurs indisponibles.
+ * @return Nombre d'événements disponibles (0 : compteurs désactivés).
+ */
+int activerCompteursMateriels(FILE *erreurs)
+{
+    static const char *noms[NB_EVENEMENTS] = {"cycles", "instructions", "défauts de cache", "défauts de prédiction"};
+    int nbDisponibles = 0;
+    int codes[NB_EVENEMENTS];
+    for (int e = 0; e < NB_EVENEMENTS; e++)
+    {
+        int fd = ouvrirEvenement(e);
+        codes[e] = errno;
+        disponibles[e] = fd >= 0;
+        if (fd >= 0)
+        {
+            close(fd);
+            nbDisponibles++;
+        }
+    }
+    if (nbDisponibles > 0 && pthread_key_create(&cleFermeture, fermerCompteurs) == 0)
+        actifs = true;
+
+    // Un seul message lorsque rien n'est disponible, sinon un par événement manquant
+    if (!actifs)
+        fprintf(erreurs, "Compteurs matériels indisponibles (%s) : seul le temps est mesuré\n", strerror(codes[0]));
+    for (int e = 0; actifs && e < NB_EVENEMENTS; e++)
+    {
+        if (!disponibles[e])
+            fprintf(erreurs, "Compteur matériel indisponible (%s) : %s\n", noms[e], strerror(codes[e]));
+    }
+    return actifs ? nbDisponibles : 0;
+}
+
+/**
+ * @fn bool evenementDisponible(EvenementMateriel evenement)
+ * @brief Indique si un événement a pu être ouvert à l'activation.
+ * @param[in] evenement Événement.
+ * @return true si l'événement est compté.
+ */
+bool evenementDisponible(EvenementMateriel evenement)
+{
+    return actifs && disponibles[evenement];
+}
+
+/**
+ * @fn void lireCompteursMateriels(uint64_t valeurs[NB_EVENEMENTS])
+ * @brief Lit les compteurs du thread appelant, ouverts à la première lecture.
+ * @param[out] valeurs Valeur de chaque événement, 0 s'il n'est pas disponible.
+ */
+void lireCompteursMateriels(uint64_t valeurs[NB_EVENEMENTS])
+{
+    memset(valeurs, 0, NB_EVENEMENTS * sizeof(uint64_t));
+    if (!actifs)
+        return;
+    if (!ouverts)
+        ouvrirCompteursThread();
+    for (int e = 0; e < NB_EVENEMENTS; e++)
+    {
+        if (descripteurs[e] >= 0 && read(descripteurs[e], &valeurs[e], sizeof(uint64_t)) != sizeof(uint64_t))
+            valeurs[e] = 0;
+    }
+}
+
+#endif // COMPTEURS_MATERIELS_C
@@ -0,0 +1,58 @@
+/**
+ * @file compteurs_materiels.h
+ * @brief Compteurs matériels du processeur (cycles, instructions, défauts de cache et de prédiction).
+ * @author Bibyk Bogdan
+ * @date 18 octobre 2026
+ *
+ * Ce fichier d'en-tête définit une couche optionnelle au-dessus de perf_event_open (Linux). Chaque
+ * thread ouvre ses propres compteurs à sa première lecture : les phases exécutées en parallèle sont
+ * mesurées séparément. Si le noyau refuse les compteurs (perf_event_paranoid, conteneur, machine
+ * virtuelle, autre système que Linux), les lectures renvoient 0 et seul le temps est mesuré.
+ *
+ */
+
+#ifndef COMPTEURS_MATERIELS_H
+#define COMPTEURS_MATERIELS_H
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @enum EvenementMateriel
+ * @brief Événements comptés.
+ */
+typedef enum EvenementMateriel
+{
+    EVT_CYCLES,          ///< Cycles processeur.
+    EVT_INSTRUCTIONS,    ///< Instructions exécutées.
+    EVT_DEFAUTS_CACHE,   ///< Défauts du dernier niveau de cache.
+    EVT_DEFAUTS_BRANCHE, ///< Mauvaises prédictions de branchement.
+    NB_EVENEMENTS
+} EvenementMateriel;
+
+/**
+ * @fn int activerCompteursMateriels(FILE *erreurs)
+ * @brief Vérifie la disponibilité des compteurs et active leur lecture.
+ * @param[out] erreurs Fichier où signaler les compteurs indisponibles.
+ * @return Nombre d'événements disponibles (0 : compteurs désactivés).
+ */
+int activerCompteursMateriels(FILE *erreurs);
+
+/**
+ * @fn bool evenementDisponible(EvenementMateriel evenement)
+ * @brief Indique si un événement a pu être ouvert à l'activation.
+ * @param[in] evenement Événement.
+ * @return true si l'événement est compté.
+ */
+bool evenementDisponible(EvenementMateriel evenement);
+
+/**
+ * @fn void lireCompteursMateriels(uint64_t valeurs[NB_EVENEMENTS])
+ * @brief Lit les compteurs du thread appelant, ouverts à la première lecture.
+ * @param[out] valeurs Valeur de chaque événement, 0 s'il n'est pas disponible.
+ */
+void lireCompteursMateriels(uint64_t valeurs[NB_EVENEMENTS]);
+
+#endif
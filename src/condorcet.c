@@ -10,149 +10,138 @@
  * - Des Paires
  * - Schulze
  *
+ * Toutes les méthodes travaillent sur la matrice des duels, calculée une seule fois.
+ * Sans vainqueur de Condorcet, Schulze et la méthode des paires ne travaillent que sur l'ensemble de Smith.
+ * Les candidats sont désignés par leur identifiant dans la table des candidats,
+ * qui est aussi l'identifiant de leur noeud dans les graphes de duels.
+ *
  */
 
 #ifndef CONDORCET_C
 #define CONDORCET_C
 
 #include "condorcet.h"
+#include "statistiques.h"
 
 //////////////////////////////
 // -- Fonctions Communes -- //
 //////////////////////////////
 
 /**
- * @fn int calculerScoreDuel(DataFrame *df, int idx_candidat, int idx_adversaire, char *candidat, char *adversaire, FILE *log, bool debugMode)
- * @brief Calcule le score d'un duel entre deux candidats.
- * @param df Le DataFrame contenant les données de vote.
- * @param[in] candidat Le nom du candidat.
- * @param[in] adversaire Le nom de l'adversaire.
- * @param[in] log Le fichier de log.
- * @param[in] debugMode Le mode debug.
- * @return Le score du duel.
+ * @fn Graph *fillGraphFromDuels(DuelMatrix *duels, CandidateTable *candidates)
+ * @brief Remplit un graphe à partir de la matrice des duels.
+ * @param[in] duels La matrice des duels.
+ * @param[in] candidates La table des candidats.
+ * @return Le graphe rempli, dont le noeud i correspond au candidat i.
  */
-static int calculerScoreDuel(DataFrame *df, char *candidat, char *adversaire, FILE *log, bool debugMode)
+static Graph *fillGraphFromDuels(DuelMatrix *duels, CandidateTable *candidates)
 {
-    int score = 0;
-    for (int k = 0; k < df->num_rows; k++)
-    {
-        char response[100];
-        sprintf(response, "%d", ((int *)df->columns[0].data)[k]);
-        Series row = getRow(df, df->columns[0].name, response);
-        int vote_candidat = selectIntFromSeries(row, candidat);     // on récupère le rang du candidat
-        int vote_adversaire = selectIntFromSeries(row, adversaire); // on récupère le rang de l'adversaire
-
-        // Si le candidat a un rang plus petit que l'adversaire, il gagne un point
-        if ((vote_candidat < vote_adversaire && vote_candidat != -1) || (vote_adversaire == -1 && vote_candidat != -1))
-            score++;
-        // Sinon, il perd un point
-        else if ((vote_candidat > vote_adversaire && vote_adversaire != -1) || (vote_candidat == -1 && vote_adversaire != -1))
-            score--;
-    }
-    return score;
-}
+    int nb_candidates = duels->nb_candidates;
+    Graph *graph = createGraph(nb_candidates, candidates->names);
 
-/**
- * @fn Graph *initGraphNodeFromDf(DataFrame *df, int *idxs_candidats, int nb_candidates)
- * @brief Initialise un graphe à partir d'un DataFrame.
- * @param[in] df Le DataFrame contenant les données de vote.
- * @param[in] idxs_candidats Les indices des candidats.
- * @param[in] nb_candidates Le nombre de candidats.
- * @return Le graphe initialisé.
- */
-static Graph *initGraphNodeFromDf(DataFrame *df, int *idxs_candidats, int nb_candidates, bool duel)
-{
-    Graph *graph = createGraph();
+    // Chaque duel gagné donne une arête pondérée par la marge de victoire
     for (int i = 0; i < nb_candidates; i++)
     {
-        char *candidat;
-        // Si le df est une matrice de duel, on récupère le nom des candidats
-        // directement à partir de l'indice 0.
-        // Sinon, on récupère le nom des candidats à partir des indices
-        // des candidats dans le df global (trouvés precedemment).
-        int idx_candidat = idxs_candidats[i];
-        candidat = df->columns[duel ? i : idx_candidat].name;
-        addNode(graph, candidat);
+        for (int j = 0; j < nb_candidates; j++)
+        {
+            int score = DUEL_MARGIN(duels, i, j);
+            if (i != j && score > 0)
+                setEdge(graph, i, j, score);
+        }
     }
     return graph;
 }
 
 /**
- * @fn void addEdge(Graph *graph, int j, int *idxs_candidats, DataFrame *df, FILE *log, bool debugMode, int idx_candidat, char *candidat)
- * @brief Ajoute une arête au graphe.
- * @param[in,out] graph Le graphe.
- * @param[in] j L'indice du candidat à affronter.
- * @param[in] idxs_candidats Les indices des candidats.
- * @param[in] df Le DataFrame contenant les données de vote.
- * @param[in] log Le fichier de log.
- * @param[in] debugMode Le mode debug.
- * @param[in] idx_candidat L'indice du candidat.
- * @param[in] candidat Le nom du candidat.
+ * @fn VoteResult resultatDuels(DuelMatrix *duels, CandidateTable *candidates, float score, int vainqueur)
+ * @brief Crée le résultat d'une méthode Condorcet à partir de la matrice des duels.
+ * @param[in] duels La matrice des duels.
+ * @param[in] candidates La table des candidats.
+ * @param[in] score Le score du vainqueur.
+ * @param[in] vainqueur L'identifiant du vainqueur.
+ * @return Le résultat du vote, avec le nombre de bulletins effectivement lus.
  */
-static void addEdge(Graph *graph, int j, int *idxs_candidats, DataFrame *df, FILE *log, bool debugMode, int idx_candidat, char *candidat, bool duel)
+static VoteResult resultatDuels(DuelMatrix *duels, CandidateTable *candidates, float score, int vainqueur)
 {
-    // on récupère l'indice de l'adversaire (dans le df global) et son nom
-    int idx_adversaire = idxs_candidats[j];
-    char *adversaire = df->columns[idx_adversaire].name;
-    int score = duel ? ((int *)df->columns[j].data)[idx_candidat]
-                     : calculerScoreDuel(df, candidat, adversaire, log, debugMode);
-
-    // si le score est positif, on ajoute une arête
-    if (score > 0)
-        setEdge(graph, candidat, adversaire, score);
+    VoteResult res = createVoteResult(candidates, duels->nb_ballots, score, vainqueur);
+    res.nb_read = duels->nb_read;
+    return res;
 }
 
 /**
- * @fn Graph *fillGraphFromDf(DataFrame *df, int *idxs_candidats, int nb_candidates, FILE *log, bool debugMode)
- * @brief Remplit un graphe à partir d'un DataFrame.
- * @param[in] df Le DataFrame contenant les données de vote.
- * @param[in] idxs_candidats Les indices des candidats.
- * @param[in] nb_candidates Le nombre de candidats.
+ * @fn bool resultatCondorcet(DuelMatrix *duels, CandidateTable *candidates, FILE *log, bool debugMode, VoteResult *res)
+ * @brief Remplit le résultat si un vainqueur de Condorcet existe.
+ * @param[in] duels La matrice des duels.
+ * @param[in] candidates La table des candidats.
  * @param[in] log Le fichier de log.
  * @param[in] debugMode Le mode debug.
- * @return Le graphe rempli.
+ * @param[out] res Le résultat du vote.
+ * @return Vrai si un vainqueur de Condorcet existe.
  */
-static Graph *fillGraphFromDf(DataFrame *df, int *idxs_candidats, int nb_candidates, FILE *log, bool debugMode, bool duel)
+static bool resultatCondorcet(DuelMatrix *duels, CandidateTable *candidates, FILE *log, bool debugMode, VoteResult *res)
 {
-    char *index_name = df->columns[0].name;
-    Graph *graph = initGraphNodeFromDf(df, idxs_candidats, nb_candidates, duel);
+    int vainqueur_condorcet = findCondorcetWinner(duels);
+    if (vainqueur_condorcet == -1)
+        return false;
 
-    // On fait affronter chaque candidat à tous les autres candidats
-    for (int i = 0; i < nb_candidates; i++)
-    {
-        int idx_candidat = duel ? i : idxs_candidats[i];
-        char *candidat = df->columns[idx_candidat].name;
-        for (int j = 0; j < nb_candidates; j++)
-        {
-            if (i != j)
-                addEdge(graph, j, idxs_candidats, df, log, debugMode, idx_candidat, candidat, duel);
-        }
-    }
-    return graph;
+    logprintf(log, debugMode, JOURNAL_RESULTATS, "Vainqueur CONDORCET: %s\n", candidates->names[vainqueur_condorcet]);
+    *res = resultatDuels(duels, candidates, 0, vainqueur_condorcet);
+    return true;
 }
 
 /**
- * @fn char *trouverVainqueurCondorcet(DataFrame *df, int *idxs_candidats, int nb_candidates, FILE *log, bool debugMode)
- * @brief Trouve le vainqueur d'un vote Condorcet.
- * @param[in] df Le DataFrame contenant les données de vote.
- * @param[in] idxs_candidats Les indices des candidats.
- * @param[in] nb_candidates Le nombre de candidats.
+ * @typedef MethodeCondorcet
+ * @brief Méthode qui désigne un vainqueur à partir d'une matrice des duels.
+ */
+typedef int (*MethodeCondorcet)(DuelMatrix *duels, CandidateTable *candidates, FILE *log, bool debugMode);
+
+/**
+ * @fn int vainqueurSurSmith(DuelMatrix *duels, CandidateTable *candidates, FILE *log, bool debugMode, MethodeCondorcet methode)
+ * @brief Applique une méthode uniquement aux candidats de l'ensemble de Smith.
+ * @param[in] duels La matrice des duels.
+ * @param[in] candidates La table des candidats.
  * @param[in] log Le fichier de log.
  * @param[in] debugMode Le mode debug.
- * @return Le nom du vainqueur.
+ * @param[in] methode La méthode à appliquer, qui doit respecter le critère de Smith.
+ * @return L'identifiant du vainqueur dans la table complète.
+ *
+ * Les candidats hors de l'ensemble de Smith perdent contre tous ses membres : ils ne peuvent
+ * ni gagner ni modifier les chemins ou les arêtes verrouillées entre les membres.
  */
-static char *trouverVainqueurCondorcet(DataFrame *df, int *idxs_candidats, int nb_candidates, FILE *log, bool debugMode, bool duel)
+static int vainqueurSurSmith(DuelMatrix *duels, CandidateTable *candidates, FILE *log, bool debugMode, MethodeCondorcet methode)
 {
-    Graph *graph = createGraph();
-    graph = initGraphNodeFromDf(df, idxs_candidats, nb_candidates, duel);
-    graph = fillGraphFromDf(df, idxs_candidats, nb_candidates, log, debugMode, duel);
-    for (int i = 0; i < nb_candidates; i++)
+    int nb_candidates = duels->nb_candidates;
+    int smith[nb_candidates + 1];
+    int nb_smith = ensembleSmith(duels, smith);
+
+    if (journalActif(debugMode, JOURNAL_DETAILS))
     {
-        char *candidat = df->columns[idxs_candidats[i]].name;
-        if (isDominant(graph, candidat))
-            return candidat;
+        int schwartz[nb_candidates + 1];
+        int nb_schwartz = ensembleSchwartz(duels, schwartz);
+        logprintf(log, debugMode, JOURNAL_DETAILS, "Ensemble de Smith (%d/%d):", nb_smith, nb_candidates);
+        for (int k = 0; k < nb_smith; k++)
+            logprintf(log, debugMode, JOURNAL_DETAILS, " %s", candidates->names[smith[k]]);
+        logprintf(log, debugMode, JOURNAL_DETAILS, "\nEnsemble de Schwartz (%d/%d):", nb_schwartz, nb_candidates);
+        for (int k = 0; k < nb_schwartz; k++)
+            logprintf(log, debugMode, JOURNAL_DETAILS, " %s", candidates->names[schwartz[k]]);
+        logprintf(log, debugMode, JOURNAL_DETAILS, "\n");
     }
-    return NULL;
+
+    if (nb_smith == nb_candidates)
+        return methode(duels, candidates, log, debugMode);
+
+    // On restreint la matrice et la table des candidats à l'ensemble de Smith
+    char *noms[nb_smith + 1];
+    for (int k = 0; k < nb_smith; k++)
+        noms[k] = candidates->names[smith[k]];
+    DuelMatrix *sous_duels = extractDuelMatrix(duels, smith, nb_smith);
+    CandidateTable *sous_candidats = createCandidateTableFromNames(noms, nb_smith);
+
+    int vainqueur = methode(sous_duels, sous_candidats, log, debugMode);
+
+    deleteCandidateTable(sous_candidats);
+    deleteDuelMatrix(sous_duels);
+    return vainqueur == -1 ? -1 : smith[vainqueur];
 }
 
 ///////////////////////////
@@ -160,169 +149,67 @@ static char *trouverVainqueurCondorcet(DataFrame *df, int *idxs_candidats, int n
 ///////////////////////////
 
 /**
- * @fn void updateWinner(char **winner, int *winner_score, char *candidat, int candidat_score)
- * @brief Met à jour le vainqueur.
- * @param[in] winner Le vainqueur actuel.
- * @param[in] winner_score Le score du vainqueur actuel.
- * @param[in] candidat Le candidat à comparer.
- * @param[in] candidat_score Le score du candidat à comparer.
- *
- * Si le score du candidat est supérieur au score du vainqueur, le vainqueur est mis à jour.
- */
-static void updateWinner(char **winner, int *winner_score, char *candidat, int candidat_score)
-{
-    if (*winner == NULL || candidat_score > *winner_score)
-    {
-        *winner = malloc(sizeof(char) * 50);
-        strcpy(*winner, candidat);
-        *winner_score = candidat_score;
-    }
-}
-
-/**
- * @fn void affronter(int j, int *idxs_candidats, DataFrame *df, FILE *log, bool debugMode, int idx_candidat, char *candidat, int *mini)
- * @brief Affronte deux candidats.
- * @param[in] j L'indice du candidat à affronter.
- * @param[in] idxs_candidats Les indices des candidats.
- * @param[in] df Le DataFrame contenant les données de vote.
+ * @fn VoteResult voteCondorcetMinimaxVariantes(DuelMatrix *duels, CandidateTable *candidates, FILE *log, bool debugMode, VoteResult *resultats)
+ * @brief Vote Condorcet par les trois variantes de la méthode MiniMax, calculées ensemble.
+ * @param[in] duels La matrice des duels.
+ * @param[in] candidates La table des candidats.
  * @param[in] log Le fichier de log.
  * @param[in] debugMode Le mode debug.
- * @param[in] candidat Le nom du candidat.
- * @param[in] mini Le score minimum.
- *
- * Fait s'affronter deux candidats et met à jour le score minimum.
+ * @param[out] resultats Le résultat de chaque variante, indexé par VarianteMinimax.
  */
-static void affronter(int j, int *idxs_candidats, DataFrame *df, FILE *log, bool debugMode, char *candidat, int *mini)
+void voteCondorcetMinimaxVariantes(DuelMatrix *duels, CandidateTable *candidates, FILE *log, bool debugMode, VoteResult *resultats)
 {
-    int idx_adversaire = idxs_candidats[j];
-    char *adversaire = df->columns[idx_adversaire].name;
-    logprintf(log, debugMode, "\tduel vs %s: ", adversaire);
-
-    // On calcule le score du duel et on met à jour le score minimum si besoin
-    int score = calculerScoreDuel(df, candidat, adversaire, log, debugMode);
-    if (score < *mini)
-        *mini = score;
-    logprintf(log, debugMode, "%d\n", score);
-}
+    logprintf(log, debugMode, JOURNAL_RESULTATS, "METHODE MINI MAX:\n");
+    ResultatsMinimax *minimax = calculerMinimax(duels);
+    if (journalActif(debugMode, JOURNAL_DETAILS))
+        printMinimax(minimax, candidates, log);
 
-/**
- * @fn char *trouverMiniMaxDuel(DataFrame *df, FILE *log, bool debugMode, int *score)
- * @brief Trouve le vainqueur de la méthode MiniMax pour un duel.
- * @param[in] df Le DataFrame contenant les données de vote.
- * @param[in] log Le fichier de log.
- * @param[in] debugMode Le mode debug.
- * @param[out] score Le score du vainqueur.
- * @return Le nom du vainqueur.
- */
-static char *trouverMiniMaxDuel(DataFrame *df, FILE *log, bool debugMode, int *score)
-{
-    logprintf(log, debugMode, "METHODE MINI MAX DUEL:\n");
-    char *winner = NULL;
-    int winner_score = 0;
-    for (int i = 0; i < df->num_columns; i++)
+    for (int v = 0; v < NB_VARIANTES_MINIMAX; v++)
     {
-        char *candidat = df->columns[i].name;
-        int score_candidat = 0;
-        Column col = dfSelect(df, candidat);
-        for (int j = 0; j < df->num_columns; j++)
-        {
-            if (i != j)
-            {
-                char *adversaire = df->columns[j].name;
-                Column col = dfSelect(df, adversaire);
-                int score_duel = ((int *)col.data)[i];
-                if (score_candidat == 0 || score_duel < score_candidat)
-                    score_candidat = score_duel;
-            }
-        }
-        logprintf(log, debugMode, "%s: %d\n", candidat, score_candidat);
-        updateWinner(&winner, &winner_score, candidat, score_candidat);
+        int vainqueur = minimax->classements[v][0];
+        int score = scoreMinimax(minimax, v, vainqueur);
+        resultats[v] = resultatDuels(duels, candidates, score, vainqueur);
+        logprintf(log, debugMode, JOURNAL_RESULTATS, "Vainqueur MINI MAX (%s): %s, avec un score de %d\n", nomVarianteMinimax(v), candidateName(candidates, vainqueur), score);
     }
-    logprintf(log, debugMode, "Vainqueur MINI MAX DUEL: %s, avec un score de %d\n\n", winner, winner_score);
-    return winner;
+    logprintf(log, debugMode, JOURNAL_RESULTATS, "\n");
+    deleteResultatsMinimax(minimax);
 }
 
 /**
- * @fn char *trouverMiniMax(DataFrame *df, int *idxs_candidats, int nb_candidates, FILE *log, bool debugMode, int *score)
- * @brief Trouve le vainqueur de la méthode MiniMax.
- * @param[in] df Le DataFrame contenant les données de vote.
- * @param[in] idxs_candidats Les indices des candidats.
- * @param[in] nb_candidates Le nombre de candidats.
+ * @fn VoteResult voteCondorcetMinimaxDuels(DuelMatrix *duels, CandidateTable *candidates, FILE *log, bool debugMode)
+ * @brief Vote Condorcet par la méthode MiniMax (marges) à partir de la matrice des duels.
+ * @param[in] duels La matrice des duels.
+ * @param[in] candidates La table des candidats.
  * @param[in] log Le fichier de log.
  * @param[in] debugMode Le mode debug.
- * @param[out] score Le score du vainqueur.
- * @return Le nom du vainqueur.
+ * @return Le résultat du vote.
  */
-static char *trouverMiniMax(DataFrame *df, int *idxs_candidats, int nb_candidates, FILE *log, bool debugMode, int *score, bool duel)
+VoteResult voteCondorcetMinimaxDuels(DuelMatrix *duels, CandidateTable *candidates, FILE *log, bool debugMode)
 {
-    if (duel)
-        return trouverMiniMaxDuel(df, log, debugMode, score);
-
-    logprintf(log, debugMode, "METHODE MINI MAX CLASSIQUE:\n");
-    char *winner = NULL;
-    int winner_score = 0;
-    for (int i = 0; i < nb_candidates; i++)
-    {
-        // On récupère le candidat et on initialise le score minimum à la taille du DataFrame
-        // En faisant ça on s'assure que n'importe quel score sera inférieur au score minimum initial
-        int idx_candidat = idxs_candidats[i];
-        int mini = df->num_rows;
-        char *candidat = df->columns[idx_candidat].name;
-        logprintf(log, debugMode, "Candidat %s:\n", candidat);
-
-        // On fait affronter le candidat à tous les autres candidats pour trouver son score minimum
-        for (int j = 0; j < nb_candidates; j++)
-        {
-            if (i != j)
-                affronter(j, idxs_candidats, df, log, debugMode, candidat, &mini);
-        }
-        logprintf(log, debugMode, "\tmini: %d\n", mini);
+    VoteResult res;
+    if (resultatCondorcet(duels, candidates, log, debugMode, &res))
+        return res;
 
-        // On met à jour le vainqueur si necessaire
-        updateWinner(&winner, &winner_score, candidat, mini);
-        logprintf(log, debugMode, "\n");
-    }
-    *score = winner_score;
-    logprintf(log, debugMode, "Vainqueur MINI MAX CLASSIQUE: %s, avec un score de %d\n\n", winner, winner_score);
-    return winner;
+    VoteResult resultats[NB_VARIANTES_MINIMAX];
+    voteCondorcetMinimaxVariantes(duels, candidates, log, debugMode, resultats);
+    return resultats[MINIMAX_MARGES];
 }
 
 /**
- * @fn VoteResult voteCondorcetMinimax(DataFrame *df, bool duel, FILE *log, bool debugMode)
+ * @fn VoteResult voteCondorcetMinimax(DataFrame *df, CandidateTable *candidates, bool duel, FILE *log, bool debugMode)
  * @brief Vote Condorcet par la méthode MiniMax.
  * @param[in] df Le DataFrame contenant les données de vote.
+ * @param[in] candidates La table des candidats.
  * @param[in] duel Si vrai, le df est une matrice de duel.
  * @param[in] log Le fichier de log.
  * @param[in] debugMode Le mode debug.
  * @return Le résultat du vote.
  */
-VoteResult voteCondorcetMinimax(DataFrame *df, bool duel, FILE *log, bool debugMode)
+VoteResult voteCondorcetMinimax(DataFrame *df, CandidateTable *candidates, bool duel, FILE *log, bool debugMode)
 {
-    // On récupère les candidats
-    int nb_candidates = duel ? df->num_columns : getNbCandidat(df);
-    int idxs_candidats[nb_candidates];
-    char *index_name = df->columns[0].name;
-    getIdxsCandidats(df, nb_candidates, idxs_candidats);
-
-    char *vainqueur_condorcet = trouverVainqueurCondorcet(df, idxs_candidats, nb_candidates, log, debugMode, duel);
-    if (vainqueur_condorcet != NULL)
-    {
-        logprintf(log, debugMode, "Vainqueur CONDORCET: %s\n", vainqueur_condorcet);
-        VoteResult res = createVoteResult(nb_candidates, df->num_rows, 0, vainqueur_condorcet);
-        //printResult(res, "cm", 1);
-        return res;
-    }
-
-    // On trouve le vainqueur et son score
-    int score;
-    char *minimax_vainqueur = trouverMiniMax(df, idxs_candidats, nb_candidates, log, debugMode, &score, duel);
-
-    // On crée le résultat du vote et on l'affiche
-    VoteResult res = createVoteResult(nb_candidates, df->num_rows, score, minimax_vainqueur);
-    // printResult(res, "cm", 1);
-
-    // On libère la mémoire et on retourne le résultat
-    free(minimax_vainqueur);
+    DuelMatrix *duels = createDuelMatrixFromDf(df, candidates, duel);
+    VoteResult res = voteCondorcetMinimaxDuels(duels, candidates, log, debugMode);
+    deleteDuelMatrix(duels);
     return res;
 }
 
@@ -331,34 +218,22 @@ VoteResult voteCondorcetMinimax(DataFrame *df, bool duel, FILE *log, bool debugM
 //////////////////////////////
 
 /**
- * @fn VoteResult voteCondorcetPaires(DataFrame *df, bool duel, FILE *log, bool debugMode)
- * @brief Vote Condorcet par la méthode Des Paires.
- * @param[in] df Le DataFrame contenant les données de vote.
- * @param[in] duel Si vrai, le df est une matrice de duel.
+ * @fn int trouverPaires(DuelMatrix *duels, CandidateTable *candidates, FILE *log, bool debugMode)
+ * @brief Trouve le vainqueur de la méthode Des Paires.
+ * @param[in] duels La matrice des duels.
+ * @param[in] candidates La table des candidats.
  * @param[in] log Le fichier de log.
  * @param[in] debugMode Le mode debug.
- * @return Le résultat du vote.
+ * @return L'identifiant du vainqueur.
  */
-VoteResult voteCondorcetPaires(DataFrame *df, bool duel, FILE *log, bool debugMode)
+static int trouverPaires(DuelMatrix *duels, CandidateTable *candidates, FILE *log, bool debugMode)
 {
-    int nb_candidates = duel ? df->num_columns : getNbCandidat(df);
-    char *candidates_names[nb_candidates];
-    int idxs_candidats[nb_candidates];
-    getIdxsCandidats(df, nb_candidates, idxs_candidats);
-    for (int i = 0; i < nb_candidates; i++)
-        candidates_names[i] = df->columns[idxs_candidats[i]].name;
+    int nb_candidates = duels->nb_candidates;
+    char **candidates_names = candidates->names;
 
-    char *vainqueur_condorcet = trouverVainqueurCondorcet(df, idxs_candidats, nb_candidates, log, debugMode, duel);
-    if (vainqueur_condorcet != NULL)
-    {
-        logprintf(log, debugMode, "Vainqueur CONDORCET: %s\n", vainqueur_condorcet);
-        VoteResult res = createVoteResult(nb_candidates, df->num_rows, 0, vainqueur_condorcet);
-        //printResult(res, "cm", 1);
-        return res;
-    }
-
-    Graph *graph = fillGraphFromDf(df, idxs_candidats, nb_candidates, log, debugMode, duel);
-    printGraph(graph, log);
+    Graph *graph = fillGraphFromDuels(duels, candidates);
+    if (journalActif(debugMode, JOURNAL_DETAILS))
+        printGraph(graph, log);
 
     // On trie les valeurs du graphe par ordre décroissant
     int *sortedValues;
@@ -367,46 +242,88 @@ VoteResult voteCondorcetPaires(DataFrame *df, bool duel, FILE *log, bool debugMo
 
     // On crée un nouveau graphe vierge
     // On ajoute les arêtes du graphe initial une par une
-    // Si une arête crée un cycle, on la supprime
-    Graph *uncycledGraph = initGraphNodeFromDf(df, idxs_candidats, nb_candidates, duel);
-    for (int i = 0; i < graph->nb_nodes * graph->nb_nodes; i++)
+    // Si une arête crée un cycle, on ne l'ajoute pas
+    Graph *uncycledGraph = createGraph(nb_candidates, candidates_names);
+    int i = 0;
+    for (; i < graph->nb_nodes * graph->nb_nodes; i++)
     {
         int value = sortedValues[i];
         if (value == 0)
             break;
 
-        char *from = candidates_names[coordinates[i * 2]];
-        char *to = candidates_names[coordinates[i * 2 + 1]];
+        int from = coordinates[i * 2];
+        int to = coordinates[i * 2 + 1];
+        // Ajouter from -> to crée un cycle si et seulement si from est déjà atteignable depuis to
+        if (hasPath(uncycledGraph, to, from))
+        {
+            logprintf(log, debugMode, JOURNAL_TRACE, "!! cycle detecté entre %s et %s !!\n", candidates_names[from], candidates_names[to]);
+            continue;
+        }
         setEdge(uncycledGraph, from, to, value);
-        fprintf(log, "\n");
-        printGraph(uncycledGraph, log);
-        logprintf(log, debugMode, "Ajout de %s -> %s\n", from, to);
-        if (isCycled(uncycledGraph))
+        // Le graphe complet après chaque arête n'est écrit qu'au niveau trace
+        if (journalActif(debugMode, JOURNAL_TRACE))
         {
-            logprintf(log, debugMode, "!! cycle detecté entre %s et %s !!\n", from, to);
-            removeEdge(uncycledGraph, from, to);
+            fprintf(log, "\n");
             printGraph(uncycledGraph, log);
         }
+        logprintf(log, debugMode, JOURNAL_TRACE, "Ajout de %s -> %s\n", candidates_names[from], candidates_names[to]);
     }
+    STATS_AJOUTER(STAT_PAIRES, i);
 
     // A partir du graphe sans cycle, on supprime les candidats non dominants
+    // (la dominance est évaluée avant toute suppression pour ne pas libérer leurs successeurs)
+    bool dominants[nb_candidates];
+    for (int i = 0; i < nb_candidates; i++)
+        dominants[i] = isDominant(uncycledGraph, i);
     for (int i = 0; i < nb_candidates; i++)
     {
-        char *candidat = candidates_names[i];
-        if (!isDominant(uncycledGraph, candidat))
-            removeNode(uncycledGraph, candidat);
+        if (!dominants[i])
+            removeNode(uncycledGraph, i);
     }
-    char *winner = uncycledGraph->nodes[0];
-
-    // On libère la mémoire et on retourne le résultat
-    VoteResult res;
-    res.nb_candidates = nb_candidates;
-    res.nb_voters = df->num_rows;
-    strcpy(res.winner, winner);
-    // printResult(res, "cp", 1);
+    int winner = firstActiveNode(uncycledGraph);
 
+    // On libère la mémoire et on retourne le vainqueur
     free(sortedValues);
     free(coordinates);
+    deleteGraph(graph);
+    deleteGraph(uncycledGraph);
+    return winner;
+}
+
+/**
+ * @fn VoteResult voteCondorcetPairesDuels(DuelMatrix *duels, CandidateTable *candidates, FILE *log, bool debugMode)
+ * @brief Vote Condorcet par la méthode Des Paires à partir de la matrice des duels.
+ * @param[in] duels La matrice des duels.
+ * @param[in] candidates La table des candidats.
+ * @param[in] log Le fichier de log.
+ * @param[in] debugMode Le mode debug.
+ * @return Le résultat du vote.
+ */
+VoteResult voteCondorcetPairesDuels(DuelMatrix *duels, CandidateTable *candidates, FILE *log, bool debugMode)
+{
+    VoteResult res;
+    if (resultatCondorcet(duels, candidates, log, debugMode, &res))
+        return res;
+
+    int winner = vainqueurSurSmith(duels, candidates, log, debugMode, trouverPaires);
+    return resultatDuels(duels, candidates, 0, winner);
+}
+
+/**
+ * @fn VoteResult voteCondorcetPaires(DataFrame *df, CandidateTable *candidates, bool duel, FILE *log, bool debugMode)
+ * @brief Vote Condorcet par la méthode Des Paires.
+ * @param[in] df Le DataFrame contenant les données de vote.
+ * @param[in] candidates La table des candidats.
+ * @param[in] duel Si vrai, le df est une matrice de duel.
+ * @param[in] log Le fichier de log.
+ * @param[in] debugMode Le mode debug.
+ * @return Le résultat du vote.
+ */
+VoteResult voteCondorcetPaires(DataFrame *df, CandidateTable *candidates, bool duel, FILE *log, bool debugMode)
+{
+    DuelMatrix *duels = createDuelMatrixFromDf(df, candidates, duel);
+    VoteResult res = voteCondorcetPairesDuels(duels, candidates, log, debugMode);
+    deleteDuelMatrix(duels);
     return res;
 }
 
@@ -415,57 +332,50 @@ VoteResult voteCondorcetPaires(DataFrame *df, bool duel, FILE *log, bool debugMo
 //////////////////////////////
 
 /**
- * @fn void calculerCheminsFort(DataFrame *df, int **chemins, int *idxs_candidats, int nb_candidates, FILE *log, bool debugMode)
+ * @fn void calculerCheminsFort(DuelMatrix *duels, int *chemins)
  * @brief Calcule les chemins les plus forts entre chaque paire de candidats.
- * @param[in] df Le DataFrame contenant les données de vote.
- * @param[in,out] chemins Les chemins les plus forts.
- * @param[in] idxs_candidats Les indices des candidats.
- * @param[in] nb_candidates Le nombre de candidats.
- * @param[in] log Le fichier de log.
- * @param[in] debugMode Le mode debug.
+ * @param[in] duels La matrice des duels.
+ * @param[out] chemins Les chemins les plus forts, matrice nb_candidates x nb_candidates.
  */
-static void calculerCheminsFort(DataFrame *df, int **chemins, int *idxs_candidats, int nb_candidates, FILE *log, bool debugMode)
+void calculerCheminsFort(DuelMatrix *duels, int *chemins)
 {
-    // Initialiser les chemins à 0
-    for (int i = 0; i < nb_candidates; i++)
-        for (int j = 0; j < nb_candidates; j++)
-            chemins[i][j] = (i == j) ? 0 : -1;
+    int nb_candidates = duels->nb_candidates;
 
     // Calculer la force des chemins directs
     for (int i = 0; i < nb_candidates; i++)
-    {
         for (int j = 0; j < nb_candidates; j++)
-        {
-            if (i != j)
-            {
-                int score = calculerScoreDuel(df, df->columns[idxs_candidats[i]].name, df->columns[idxs_candidats[j]].name, log, debugMode);
-                chemins[i][j] = score;
-            }
-        }
-    }
+            chemins[i * nb_candidates + j] = (i == j) ? 0 : DUEL_MARGIN(duels, i, j);
 
     // Calculer les chemins les plus forts pour chaque paire de candidats
+    uint64_t compares = 0;
     for (int k = 0; k < nb_candidates; k++)
+    {
+        int *ligne_k = &chemins[k * nb_candidates];
         for (int i = 0; i < nb_candidates; i++)
+        {
+            int *ligne_i = &chemins[i * nb_candidates];
+            int force_ik = ligne_i[k];
+            if (force_ik <= 0)
+                continue;
+            compares += nb_candidates;
             for (int j = 0; j < nb_candidates; j++)
-                if (chemins[i][k] > 0 && chemins[k][j] > 0)
-                    chemins[i][j] = max(chemins[i][j], min(chemins[i][k], chemins[k][j]));
+                if (ligne_k[j] > 0)
+                    ligne_i[j] = max(ligne_i[j], min(force_ik, ligne_k[j]));
+        }
+    }
+    STATS_AJOUTER(STAT_CHEMINS, compares);
 }
 
 /**
- * @fn char *trouverVainqueurSchulze(DataFrame *df, int *idxs_candidats, int nb_candidates, int **chemins, FILE *log, bool debugMode)
+ * @fn int trouverVainqueurSchulze(int nb_candidates, int *chemins)
  * @brief Trouve le vainqueur de la méthode Schulze.
- * @param[in] df Le DataFrame contenant les données de vote.
- * @param[in] idxs_candidats Les indices des candidats.
  * @param[in] nb_candidates Le nombre de candidats.
  * @param[in] chemins Les chemins les plus forts.
- * @param[in] log Le fichier de log.
- * @param[in] debugMode Le mode debug.
- * @return Le nom du vainqueur.
+ * @return L'identifiant du vainqueur.
  */
-static char *trouverVainqueurSchulze(DataFrame *df, int *idxs_candidats, int nb_candidates, int **chemins, FILE *log, bool debugMode)
+int trouverVainqueurSchulze(int nb_candidates, int *chemins)
 {
-    char *winner = NULL;
+    int winner = -1;
     int best_score = -1;
 
     for (int i = 0; i < nb_candidates; i++)
@@ -473,13 +383,13 @@ static char *trouverVainqueurSchulze(DataFrame *df, int *idxs_candidats, int nb_
         int score = 0;
         for (int j = 0; j < nb_candidates; j++)
         {
-            if (i != j && chemins[i][j] > chemins[j][i])
+            if (i != j && chemins[i * nb_candidates + j] > chemins[j * nb_candidates + i])
                 score++;
         }
         if (score > best_score)
         {
             best_score = score;
-            winner = df->columns[idxs_candidats[i]].name;
+            winner = i;
         }
     }
 
@@ -487,62 +397,65 @@ static char *trouverVainqueurSchulze(DataFrame *df, int *idxs_candidats, int nb_
 }
 
 /**
- * @fn VoteResult voteCondorcetSchulze(DataFrame *df, bool duel, FILE *log, bool debugMode)
- * @brief Vote Condorcet par la méthode De Schulze.
- * @param[in] df Le DataFrame contenant les données de vote.
- * @param[in] duel Si vrai, le df est une matrice de duel.
+ * @fn int trouverSchulze(DuelMatrix *duels, CandidateTable *candidates, FILE *log, bool debugMode)
+ * @brief Trouve le vainqueur de la méthode De Schulze.
+ * @param[in] duels La matrice des duels.
+ * @param[in] candidates La table des candidats.
  * @param[in] log Le fichier de log.
  * @param[in] debugMode Le mode debug.
+ * @return L'identifiant du vainqueur.
  */
-VoteResult voteCondorcetSchulze(DataFrame *df, bool duel, FILE *log, bool debugMode)
+static int trouverSchulze(DuelMatrix *duels, CandidateTable *candidates, FILE *log, bool debugMode)
 {
-    // On récupère les candidats
-    int nb_candidates = duel ? df->num_columns : getNbCandidat(df);
-    int idxs_candidats[nb_candidates];
-    if (duel)
-    {
-        for (int i = 0; i < nb_candidates; i++)
-            idxs_candidats[i] = i;
-    }
-    else
-    {
-        getIdxsCandidats(df, nb_candidates, idxs_candidats);
-    }
-    char *vainqueur_condorcet = trouverVainqueurCondorcet(df, idxs_candidats, nb_candidates, log, debugMode, duel);
-    if (vainqueur_condorcet != NULL)
-    {
-        logprintf(log, debugMode, "Vainqueur CONDORCET: %s\n", vainqueur_condorcet);
-        VoteResult res = createVoteResult(nb_candidates, df->num_rows, 0, vainqueur_condorcet);
-        //printResult(res, "cm", 1);
-        return res;
-    }
+    int nb_candidates = duels->nb_candidates;
 
     // On calcule les chemins les plus forts
-    int **chemins = malloc(nb_candidates * sizeof(int *));
-    for (int i = 0; i < nb_candidates; i++)
-        chemins[i] = malloc(nb_candidates * sizeof(int));
-    calculerCheminsFort(df, chemins, idxs_candidats, nb_candidates, log, debugMode);
+    int *chemins = malloc((nb_candidates * nb_candidates + 1) * sizeof(int));
+    calculerCheminsFort(duels, chemins);
 
     // On trouve le vainqueur
-    char *vainqueur = trouverVainqueurSchulze(df, idxs_candidats, nb_candidates, chemins, log, debugMode);
+    int vainqueur = trouverVainqueurSchulze(nb_candidates, chemins);
+    logprintf(log, debugMode, JOURNAL_RESULTATS, "Vainqueur SCHULZE: %s\n", candidateName(candidates, vainqueur));
 
-    // On libère la mémoire et on retourne le résultat
-    for (int i = 0; i < nb_candidates; i++)
-        free(chemins[i]);
+    // On libère la mémoire et on retourne le vainqueur
     free(chemins);
-    VoteResult res = createVoteResult(nb_candidates, df->num_rows, 0, vainqueur); // Score peut être 0 ou une autre valeur pertinente
-    // printResult(res, "cs", 1);
+    return vainqueur;
+}
 
-    return res;
+/**
+ * @fn VoteResult voteCondorcetSchulzeDuels(DuelMatrix *duels, CandidateTable *candidates, FILE *log, bool debugMode)
+ * @brief Vote Condorcet par la méthode De Schulze à partir de la matrice des duels.
+ * @param[in] duels La matrice des duels.
+ * @param[in] candidates La table des candidats.
+ * @param[in] log Le fichier de log.
+ * @param[in] debugMode Le mode debug.
+ * @return Le résultat du vote.
+ */
+VoteResult voteCondorcetSchulzeDuels(DuelMatrix *duels, CandidateTable *candidates, FILE *log, bool debugMode)
+{
+    VoteResult res;
+    if (resultatCondorcet(duels, candidates, log, debugMode, &res))
+        return res;
+
+    int vainqueur = vainqueurSurSmith(duels, candidates, log, debugMode, trouverSchulze);
+    return resultatDuels(duels, candidates, 0, vainqueur); // Score peut être 0 ou une autre valeur pertinente
 }
 
-//int main(void)
-//{
-//    DataFrame *df = createDataFrameFromCsv("data/VoteCondorcet.csv");
-//    FILE *log = fopen("log", "w");
-//    VoteResult res = voteCondorcetMinimax(df, false, log, true);
-//    VoteResult res2 = voteCondorcetPaires(df, false, log, true);
-//    VoteResult res3 = voteCondorcetSchulze(df, false, log, true);
-//}
+/**
+ * @fn VoteResult voteCondorcetSchulze(DataFrame *df, CandidateTable *candidates, bool duel, FILE *log, bool debugMode)
+ * @brief Vote Condorcet par la méthode De Schulze.
+ * @param[in] df Le DataFrame contenant les données de vote.
+ * @param[in] candidates La table des candidats.
+ * @param[in] duel Si vrai, le df est une matrice de duel.
+ * @param[in] log Le fichier de log.
+ * @param[in] debugMode Le mode debug.
+ */
+VoteResult voteCondorcetSchulze(DataFrame *df, CandidateTable *candidates, bool duel, FILE *log, bool debugMode)
+{
+    DuelMatrix *duels = createDuelMatrixFromDf(df, candidates, duel);
+    VoteResult res = voteCondorcetSchulzeDuels(duels, candidates, log, debugMode);
+    deleteDuelMatrix(duels);
+    return res;
+}
 
 #endif
@@ -14,40 +14,110 @@
 #include "lecture_csv.h"
 #include "utils.h"
 #include "graph.h"
+#include "candidats.h"
+#include "duels.h"
+#include "minimax.h"
+#include "smith.h"
 #include <stdbool.h>
 
 
 /**
- * @fn condorcetMinimax(DataFrame df, bool duel, FILE *log, bool debugMode);
+ * @fn VoteResult voteCondorcetMinimax(DataFrame *df, CandidateTable *candidates, bool duel, FILE *log, bool debugMode);
  * @brief Fonction pour effectuer un vote Condorcet utilisant la méthode minimax.
  * @param[in] df Pointeur vers le DataFrame contenant les résultats du vote.
+ * @param[in] candidates Table des candidats.
  * @param[in] duel Indique si le DataFrame est en un fichier de duels.
  * @param[in] log Pointeur vers le fichier journal des sorties.
  * @param[in] dubugMode Indique si le mode débogage est activé.
  * @return Structure VoteResult contenant les résultats du vote Condorcet utilisant la méthode minimax.
  */
-VoteResult voteCondorcetMinimax(DataFrame *df, bool duel, FILE *log, bool debugMode);
+VoteResult voteCondorcetMinimax(DataFrame *df, CandidateTable *candidates, bool duel, FILE *log, bool debugMode);
 
 /**
- * @fn condorcetMinimax(DataFrame df, bool duel, FILE *log, bool debugMode);
+ * @fn VoteResult voteCondorcetSchulze(DataFrame *df, CandidateTable *candidates, bool duel, FILE *log, bool debugMode);
  * @brief Fonction pour effectuer un vote Condorcet utilisant la méthode Schulze.
  * @param[in] df Pointeur vers le DataFrame contenant les résultats du vote.
+ * @param[in] candidates Table des candidats.
  * @param[in] duel Indique si le DataFrame est en un fichier de duels.
  * @param[in] log Pointeur vers le fichier journal des sorties.
  * @param[in] dubugMode Indique si le mode débogage est activé.
  * @return Structure VoteResult contenant les résultats du vote Condorcet utilisant la méthode Schulze.
  */
-VoteResult voteCondorcetSchulze(DataFrame *df, bool duel, FILE *log, bool debugMode);
+VoteResult voteCondorcetSchulze(DataFrame *df, CandidateTable *candidates, bool duel, FILE *log, bool debugMode);
 
 /**
- * @fn condorcetMinimax(DataFrame df, bool duel, FILE *log, bool debugMode);
+ * @fn VoteResult voteCondorcetPaires(DataFrame *df, CandidateTable *candidates, bool duel, FILE *log, bool debugMode);
  * @brief Fonction pour effectuer un vote Condorcet utilisant la méthode des paires.
  * @param[in] df Pointeur vers le DataFrame contenant les résultats du vote.
+ * @param[in] candidates Table des candidats.
  * @param[in] duel Indique si le DataFrame est en un fichier de duels.
  * @param[in] log Pointeur vers le fichier journal des sorties.
  * @param[in] dubugMode Indique si le mode débogage est activé.
  * @return Structure VoteResult contenant les résultats du vote Condorcet utilisant la méthode des paires.
  */
-VoteResult voteCondorcetPaires(DataFrame *df, bool duel, FILE *log, bool debugMode);
+VoteResult voteCondorcetPaires(DataFrame *df, CandidateTable *candidates, bool duel, FILE *log, bool debugMode);
+
+/**
+ * @fn VoteResult voteCondorcetMinimaxDuels(DuelMatrix *duels, CandidateTable *candidates, FILE *log, bool debugMode);
+ * @brief Fonction pour effectuer un vote Condorcet minimax à partir d'une matrice des duels déjà calculée.
+ * @param[in] duels Matrice des duels.
+ * @param[in] candidates Table des candidats.
+ * @param[in] log Pointeur vers le fichier journal des sorties.
+ * @param[in] dubugMode Indique si le mode débogage est activé.
+ * @return Structure VoteResult contenant les résultats du vote Condorcet utilisant la méthode minimax.
+ */
+VoteResult voteCondorcetMinimaxDuels(DuelMatrix *duels, CandidateTable *candidates, FILE *log, bool debugMode);
+
+/**
+ * @fn void voteCondorcetMinimaxVariantes(DuelMatrix *duels, CandidateTable *candidates, FILE *log, bool debugMode, VoteResult *resultats);
+ * @brief Fonction pour effectuer en une seule fois les votes Condorcet minimax par votes gagnants, marges et opposition.
+ * @param[in] duels Matrice des duels.
+ * @param[in] candidates Table des candidats.
+ * @param[in] log Pointeur vers le fichier journal des sorties.
+ * @param[in] dubugMode Indique si le mode débogage est activé.
+ * @param[out] resultats Tableau de NB_VARIANTES_MINIMAX résultats, indexé par VarianteMinimax.
+ *
+ * @note La variante par opposition ne respecte pas le critère de Condorcet : son vainqueur peut différer du vainqueur de Condorcet.
+ */
+void voteCondorcetMinimaxVariantes(DuelMatrix *duels, CandidateTable *candidates, FILE *log, bool debugMode, VoteResult *resultats);
+
+/**
+ * @fn VoteResult voteCondorcetSchulzeDuels(DuelMatrix *duels, CandidateTable *candidates, FILE *log, bool debugMode);
+ * @brief Fonction pour effectuer un vote Condorcet Schulze à partir d'une matrice des duels déjà calculée.
+ * @param[in] duels Matrice des duels.
+ * @param[in] candidates Table des candidats.
+ * @param[in] log Pointeur vers le fichier journal des sorties.
+ * @param[in] dubugMode Indique si le mode débogage est activé.
+ * @return Structure VoteResult contenant les résultats du vote Condorcet utilisant la méthode Schulze.
+ */
+VoteResult voteCondorcetSchulzeDuels(DuelMatrix *duels, CandidateTable *candidates, FILE *log, bool debugMode);
+
+/**
+ * @fn VoteResult voteCondorcetPairesDuels(DuelMatrix *duels, CandidateTable *candidates, FILE *log, bool debugMode);
+ * @brief Fonction pour effectuer un vote Condorcet des paires à partir d'une matrice des duels déjà calculée.
+ * @param[in] duels Matrice des duels.
+ * @param[in] candidates Table des candidats.
+ * @param[in] log Pointeur vers le fichier journal des sorties.
+ * @param[in] dubugMode Indique si le mode débogage est activé.
+ * @return Structure VoteResult contenant les résultats du vote Condorcet utilisant la méthode des paires.
+ */
+VoteResult voteCondorcetPairesDuels(DuelMatrix *duels, CandidateTable *candidates, FILE *log, bool debugMode);
+
+/**
+ * @fn void calculerCheminsFort(DuelMatrix *duels, int *chemins);
+ * @brief Fonction de calcul des chemins les plus forts de la méthode Schulze, en O(C³).
+ * @param[in] duels Matrice des duels.
+ * @param[out] chemins Matrice nb_candidates x nb_candidates des forces des chemins.
+ */
+void calculerCheminsFort(DuelMatrix *duels, int *chemins);
+
+/**
+ * @fn int trouverVainqueurSchulze(int nb_candidates, int *chemins);
+ * @brief Fonction de recherche du vainqueur de Schulze à partir des chemins les plus forts.
+ * @param[in] nb_candidates Nombre de candidats.
+ * @param[in] chemins Matrice des forces des chemins.
+ * @return Identifiant du vainqueur.
+ */
+int trouverVainqueurSchulze(int nb_candidates, int *chemins);
 
 #endif
\ No newline at end of file
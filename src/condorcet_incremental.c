@@ -0,0 +1,393 @@
+/**
+ * @file condorcet_incremental.c
+ * @brief Résultats Condorcet mis à jour bulletin par bulletin.
+ * @author Bibyk Bogdan
+ * @date 18 octobre 2026
+ *
+ * Ce fichier contient l'implémentation du moteur incrémental Condorcet.
+ * Un bulletin ne modifie chaque marge que de ±1 :
+ * - le vainqueur de Condorcet se revérifie en O(C) ;
+ * - les pires défaites d'un candidat ne peuvent qu'augmenter quand il perd des voix dans un duel
+ *   (mise à jour en O(1)), elles ne sont recalculées que si le duel qui les réalisait s'améliore ;
+ * - un arc i -> j du graphe des marges ne change aucun chemin le plus fort tant qu'un chemin
+ *   strictement plus fort que lui relie déjà i à j ; sinon, renforcé, il est propagé en O(C²), et
+ *   les chemins de Schulze ne sont recalculés que lorsqu'il s'affaiblit.
+ *
+ */
+
+#ifndef CONDORCET_INCREMENTAL_C
+#define CONDORCET_INCREMENTAL_C
+
+#include "condorcet_incremental.h"
+
+/**
+ * @fn static void *allocIncrementalMem(size_t size)
+ * @brief Fonction d'allocation mémoire initialisée à zéro, avec arrêt du programme en cas d'échec.
+ * @param[in] size Taille à allouer.
+ * @return Pointeur vers la mémoire allouée.
+ */
+static void *allocIncrementalMem(size_t size)
+{
+    void *ptr = calloc(1, size);
+    if (ptr == NULL)
+    {
+        perror("Erreur d'allocation mémoire");
+        exit(EXIT_FAILURE);
+    }
+    return ptr;
+}
+
+/**
+ * @fn static void renforcerArc(IncrementalCondorcet *engine, int depart, int arrivee, int force)
+ * @brief Met à jour tous les chemins après le renforcement d'un arc, en O(C²).
+ * @param[in, out] engine Moteur incrémental.
+ * @param[in] depart Candidat de départ de l'arc.
+ * @param[in] arrivee Candidat d'arrivée de l'arc.
+ * @param[in] force Nouvelle marge de l'arc, positive.
+ *
+ * Le meilleur chemin de i à j qui emprunte l'arc passe par le plus fort chemin de i à depart et par
+ * le plus fort chemin d'arrivee à j : sa force est le minimum des trois. Comme dans calculerCheminsFort,
+ * la diagonale reçoit le plus fort cycle passant par chaque candidat.
+ */
+static void renforcerArc(IncrementalCondorcet *engine, int depart, int arrivee, int force)
+{
+    int nb_candidates = engine->duels->nb_candidates;
+    int *chemins = engine->chemins;
+    for (int i = 0; i < nb_candidates; i++)
+    {
+        int avant = i == depart ? force : min(chemins[i * nb_candidates + depart], force);
+        if (avant <= 0)
+            continue;
+        int *ligne_i = &chemins[i * nb_candidates];
+        const int *ligne_arrivee = &chemins[arrivee * nb_candidates];
+        for (int j = 0; j < nb_candidates; j++)
+        {
+            int via = j == arrivee ? avant : min(avant, ligne_arrivee[j]);
+            if (via > 0 && via > ligne_i[j])
+                ligne_i[j] = via;
+        }
+    }
+}
+
+/**
+ * @fn static void marquerArc(IncrementalCondorcet *engine, int depart, int arrivee, int marge, int nouvelle)
+ * @brief Met à jour les chemins d'un arc dont la marge change d'une voix, ou les invalide.
+ * @param[in, out] engine Moteur incrémental.
+ * @param[in] depart Candidat de départ de l'arc.
+ * @param[in] arrivee Candidat d'arrivée de l'arc.
+ * @param[in] marge Marge de départ contre arrivée avant le bulletin.
+ * @param[in] nouvelle Marge après le bulletin.
+ *
+ * Un chemin ne passe que par des marges positives. Quand le plus fort chemin de départ à arrivée est
+ * strictement plus fort que l'ancienne marge, l'arc ne change rien : tout chemin qui l'emprunte se
+ * détourne par ce chemin sans s'affaiblir. Sinon, l'arc porte le goulet d'au moins un plus fort chemin :
+ * renforcé, il se propage en O(C²) ; affaibli, les chemins qu'il portait doivent être recalculés.
+ * Sans chemin positif, calculerCheminsFort garde la marge directe, mise à jour ici.
+ */
+static void marquerArc(IncrementalCondorcet *engine, int depart, int arrivee, int marge, int nouvelle)
+{
+    int *chemin = &engine->chemins[depart * engine->duels->nb_candidates + arrivee];
+    if (marge <= 0 && nouvelle <= 0)
+    {
+        if (*chemin <= 0)
+            *chemin = nouvelle;
+    }
+    else if (*chemin <= marge)
+    {
+        // Au-delà de C renforcements, un recalcul complet en O(C³) ne coûte pas plus cher
+        if (nouvelle > marge && engine->nb_renforcements < engine->duels->nb_candidates)
+        {
+            renforcerArc(engine, depart, arrivee, nouvelle);
+            engine->nb_renforcements++;
+        }
+        else
+            engine->chemins_dirty = true;
+    }
+}
+
+/**
+ * @fn static void preferer(IncrementalCondorcet *engine, int gagnant, int perdant)
+ * @brief Enregistre qu'un électeur préfère un candidat à un autre et met à jour les caches concernés.
+ * @param[in, out] engine Moteur incrémental.
+ * @param[in] gagnant Identifiant du candidat préféré.
+ * @param[in] perdant Identifiant de l'autre candidat.
+ */
+static void preferer(IncrementalCondorcet *engine, int gagnant, int perdant)
+{
+    DuelMatrix *duels = engine->duels;
+    ResultatsMinimax *minimax = engine->minimax;
+    int pour = DUEL_WINS(duels, gagnant, perdant);
+    int contre = DUEL_WINS(duels, perdant, gagnant);
+
+    // Le duel s'améliore pour le gagnant : s'il réalisait une de ses pires défaites, elle doit être recalculée
+    if (minimax->scores[MINIMAX_MARGES][gagnant] == contre - pour
+        || (contre > pour && minimax->scores[MINIMAX_VOTES_GAGNANTS][gagnant] == contre))
+        engine->minimax_dirty[gagnant] = true;
+
+    if (!engine->chemins_dirty)
+    {
+        marquerArc(engine, gagnant, perdant, pour - contre, pour - contre + 1);
+        marquerArc(engine, perdant, gagnant, contre - pour, contre - pour - 1);
+    }
+
+    DUEL_WINS(duels, gagnant, perdant)++;
+
+    // Le duel se dégrade pour le perdant : ses pires défaites ne peuvent qu'augmenter
+    enregistrerDuelMinimax(minimax, perdant, contre, pour + 1);
+    engine->classements_dirty = true;
+}
+
+/**
+ * @fn static void terminerBulletin(IncrementalCondorcet *engine)
+ * @brief Met à jour les caches globaux après l'ajout d'un bulletin.
+ * @param[in, out] engine Moteur incrémental.
+ */
+static void terminerBulletin(IncrementalCondorcet *engine)
+{
+    engine->duels->nb_ballots++;
+    engine->duels->nb_read++;
+    engine->condorcet_winner = findCondorcetWinner(engine->duels);
+}
+
+/**
+ * @fn IncrementalCondorcet *createIncrementalCondorcet(CandidateTable *candidates)
+ * @brief Création d'un moteur incrémental sans aucun bulletin.
+ * @param[in] candidates Table des candidats.
+ * @return Moteur incrémental.
+ */
+IncrementalCondorcet *createIncrementalCondorcet(CandidateTable *candidates)
+{
+    return createIncrementalCondorcetFromDuels(createDuelMatrix(candidates->nb_candidates), candidates);
+}
+
+/**
+ * @fn IncrementalCondorcet *createIncrementalCondorcetFromDuels(DuelMatrix *duels, CandidateTable *candidates)
+ * @brief Création d'un moteur incrémental à partir d'une matrice des duels déjà calculée.
+ * @param[in] duels Matrice des duels complète (le moteur en prend possession).
+ * @param[in] candidates Table des candidats.
+ * @return Moteur incrémental.
+ */
+IncrementalCondorcet *createIncrementalCondorcetFromDuels(DuelMatrix *duels, CandidateTable *candidates)
+{
+    int nb_candidates = duels->nb_candidates;
+    IncrementalCondorcet *engine = allocIncrementalMem(sizeof(IncrementalCondorcet));
+    engine->duels = duels;
+    engine->candidates = candidates;
+    engine->condorcet_winner = findCondorcetWinner(duels);
+    engine->minimax = calculerMinimax(duels);
+    engine->minimax_dirty = allocIncrementalMem((nb_candidates + 1) * sizeof(bool));
+    engine->chemins = allocIncrementalMem(((size_t)nb_candidates * nb_candidates + 1) * sizeof(int));
+    calculerCheminsFort(duels, engine->chemins);
+    return engine;
+}
+
+/**
+ * @fn void addBallotIncremental(IncrementalCondorcet *engine, const int *ranks)
+ * @brief Ajout d'un bulletin complet, en O(C²).
+ * @param[in, out] engine Moteur incrémental.
+ * @param[in] ranks Rang donné à chaque candidat (indexé par identifiant, -1 si non classé).
+ */
+void addBallotIncremental(IncrementalCondorcet *engine, const int *ranks)
+{
+    int nb_candidates = engine->duels->nb_candidates;
+    for (int i = 0; i < nb_candidates; i++)
+    {
+        unsigned int a = (unsigned int)ranks[i];
+        for (int j = 0; j < nb_candidates; j++)
+        {
+            if (a < (unsigned int)ranks[j])
+                preferer(engine, i, j);
+        }
+    }
+    terminerBulletin(engine);
+}
+
+/**
+ * @fn void addTruncatedBallotIncremental(IncrementalCondorcet *engine, const int *order, int nb_ranked)
+ * @brief Ajout d'un bulletin tronqué, en O(k·C).
+ * @param[in, out] engine Moteur incrémental.
+ * @param[in] order Identifiants des candidats classés, du préféré au moins préféré.
+ * @param[in] nb_ranked Nombre k de candidats classés.
+ */
+void addTruncatedBallotIncremental(IncrementalCondorcet *engine, const int *order, int nb_ranked)
+{
+    int nb_candidates = engine->duels->nb_candidates;
+    bool placed[nb_candidates + 1];
+    memset(placed, 0, sizeof(placed));
+
+    for (int p = 0; p < nb_ranked; p++)
+    {
+        int a = order[p];
+        placed[a] = true;
+        for (int j = 0; j < nb_candidates; j++)
+        {
+            if (!placed[j])
+                preferer(engine, a, j);
+        }
+    }
+    terminerBulletin(engine);
+}
+
+/**
+ * @fn int incrementalCondorcetWinner(IncrementalCondorcet *engine)
+ * @brief Vainqueur de Condorcet courant, en O(1).
+ * @param[in] engine Moteur incrémental.
+ * @return Identifiant du vainqueur de Condorcet, -1 s'il n'existe pas.
+ */
+int incrementalCondorcetWinner(IncrementalCondorcet *engine)
+{
+    return engine->condorcet_winner;
+}
+
+/**
+ * @fn static void actualiserMinimax(IncrementalCondorcet *engine)
+ * @brief Recalcule les candidats marqués, puis les classements si un score a changé.
+ * @param[in, out] engine Moteur incrémental.
+ */
+static void actualiserMinimax(IncrementalCondorcet *engine)
+{
+    for (int i = 0; i < engine->duels->nb_candidates; i++)
+    {
+        if (engine->minimax_dirty[i])
+        {
+            recalculerMinimaxCandidat(engine->minimax, engine->duels, i);
+            engine->minimax_dirty[i] = false;
+        }
+    }
+    if (engine->classements_dirty)
+    {
+        classerMinimax(engine->minimax);
+        engine->classements_dirty = false;
+    }
+}
+
+/**
+ * @fn static void actualiserChemins(IncrementalCondorcet *engine)
+ * @brief Recalcule les chemins de Schulze s'ils ont été invalidés et qu'ils servent.
+ * @param[in, out] engine Moteur incrémental.
+ *
+ * Avec un vainqueur de Condorcet, Schulze n'a pas besoin des chemins : le recalcul attend.
+ */
+static void actualiserChemins(IncrementalCondorcet *engine)
+{
+    if (engine->chemins_dirty && engine->condorcet_winner == -1)
+    {
+        calculerCheminsFort(engine->duels, engine->chemins);
+        engine->chemins_dirty = false;
+        engine->nb_renforcements = 0;
+        engine->nb_recalculs_chemins++;
+    }
+}
+
+/**
+ * @fn void actualiserIncrementalCondorcet(IncrementalCondorcet *engine)
+ * @brief Recalcule les caches invalidés depuis le dernier appel.
+ * @param[in, out] engine Moteur incrémental.
+ */
+void actualiserIncrementalCondorcet(IncrementalCondorcet *engine)
+{
+    actualiserMinimax(engine);
+    actualiserChemins(engine);
+}
+
+/**
+ * @fn static VoteResult resultatIncremental(IncrementalCondorcet *engine, float score, int vainqueur)
+ * @brief Crée un résultat sur tous les bulletins reçus par le moteur.
+ * @param[in] engine Moteur incrémental.
+ * @param[in] score Score du vainqueur.
+ * @param[in] vainqueur Identifiant du vainqueur.
+ * @return Résultat du vote.
+ */
+static VoteResult resultatIncremental(IncrementalCondorcet *engine, float score, int vainqueur)
+{
+    VoteResult res = createVoteResult(engine->candidates, engine->duels->nb_ballots, score, vainqueur);
+    res.nb_read = engine->duels->nb_read;
+    return res;
+}
+
+/**
+ * @fn void incrementalMinimaxVariantes(IncrementalCondorcet *engine, FILE *log, bool debugMode, VoteResult *resultats)
+ * @brief Résultats courants des trois variantes de minimax.
+ * @param[in, out] engine Moteur incrémental.
+ * @param[in] log Fichier de log.
+ * @param[in] debugMode Mode debug.
+ * @param[out] resultats Résultat de chaque variante, indexé par VarianteMinimax.
+ */
+void incrementalMinimaxVariantes(IncrementalCondorcet *engine, FILE *log, bool debugMode, VoteResult *resultats)
+{
+    actualiserMinimax(engine);
+    ResultatsMinimax *minimax = engine->minimax;
+
+    logprintf(log, debugMode, JOURNAL_RESULTATS, "METHODE MINI MAX:\n");
+    if (journalActif(debugMode, JOURNAL_DETAILS))
+        printMinimax(minimax, engine->candidates, log);
+    for (int v = 0; v < NB_VARIANTES_MINIMAX; v++)
+    {
+        int vainqueur = minimax->classements[v][0];
+        int score = scoreMinimax(minimax, v, vainqueur);
+        resultats[v] = resultatIncremental(engine, score, vainqueur);
+        logprintf(log, debugMode, JOURNAL_RESULTATS, "Vainqueur MINI MAX (%s): %s, avec un score de %d\n", nomVarianteMinimax(v), candidateName(engine->candidates, vainqueur), score);
+    }
+    logprintf(log, debugMode, JOURNAL_RESULTATS, "\n");
+}
+
+/**
+ * @fn VoteResult incrementalSchulze(IncrementalCondorcet *engine, FILE *log, bool debugMode)
+ * @brief Résultat Condorcet Schulze courant.
+ * @param[in, out] engine Moteur incrémental.
+ * @param[in] log Fichier de log.
+ * @param[in] debugMode Mode debug.
+ * @return Structure VoteResult, identique à celle de voteCondorcetSchulzeDuels.
+ *
+ * Les chemins sont calculés sur tous les candidats : un candidat hors de l'ensemble de Smith perd
+ * contre tous ses membres et ne peut ni gagner ni changer les chemins entre eux, si bien que le
+ * vainqueur est celui du calcul restreint à l'ensemble de Smith.
+ */
+VoteResult incrementalSchulze(IncrementalCondorcet *engine, FILE *log, bool debugMode)
+{
+    CandidateTable *candidates = engine->candidates;
+    if (engine->condorcet_winner != -1)
+    {
+        logprintf(log, debugMode, JOURNAL_RESULTATS, "Vainqueur CONDORCET: %s\n", candidates->names[engine->condorcet_winner]);
+        return resultatIncremental(engine, 0, engine->condorcet_winner);
+    }
+
+    actualiserChemins(engine);
+    int vainqueur = trouverVainqueurSchulze(engine->duels->nb_candidates, engine->chemins);
+    logprintf(log, debugMode, JOURNAL_RESULTATS, "Vainqueur SCHULZE: %s\n", candidateName(candidates, vainqueur));
+    return resultatIncremental(engine, 0, vainqueur);
+}
+
+/**
+ * @fn VoteResult incrementalPaires(IncrementalCondorcet *engine, FILE *log, bool debugMode)
+ * @brief Résultat Condorcet des paires courant.
+ * @param[in] engine Moteur incrémental.
+ * @param[in] log Fichier de log.
+ * @param[in] debugMode Mode debug.
+ * @return Structure VoteResult, identique à celle de voteCondorcetPairesDuels.
+ */
+VoteResult incrementalPaires(IncrementalCondorcet *engine, FILE *log, bool debugMode)
+{
+    if (engine->condorcet_winner != -1)
+    {
+        logprintf(log, debugMode, JOURNAL_RESULTATS, "Vainqueur CONDORCET: %s\n", engine->candidates->names[engine->condorcet_winner]);
+        return resultatIncremental(engine, 0, engine->condorcet_winner);
+    }
+    return voteCondorcetPairesDuels(engine->duels, engine->candidates, log, debugMode);
+}
+
+/**
+ * @fn void deleteIncrementalCondorcet(IncrementalCondorcet *engine)
+ * @brief Suppression du moteur incrémental et de sa matrice des duels.
+ * @param[in] engine Moteur incrémental.
+ */
+void deleteIncrementalCondorcet(IncrementalCondorcet *engine)
+{
+    deleteDuelMatrix(engine->duels);
+    deleteResultatsMinimax(engine->minimax);
+    free(engine->minimax_dirty);
+    free(engine->chemins);
+    free(engine);
+}
+
+#endif // CONDORCET_INCREMENTAL_C
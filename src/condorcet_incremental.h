@@ -0,0 +1,140 @@
+/**
+ * @file condorcet_incremental.h
+ * @brief Résultats Condorcet mis à jour bulletin par bulletin.
+ * @author Bibyk Bogdan
+ * @date 18 octobre 2026
+ *
+ * Ce fichier d'en-tête définit un moteur incrémental pour les méthodes Condorcet :
+ * la matrice des duels est mise à jour à chaque nouveau bulletin et les résultats
+ * intermédiaires (vainqueur de Condorcet, scores minimax, chemins de Schulze) sont gardés
+ * en cache pour ne recalculer que ce qu'une marge modifiée peut affecter.
+ * Il sert au mode service, qui reçoit les bulletins un par un (demande "ajout").
+ *
+ */
+
+#ifndef CONDORCET_INCREMENTAL_H
+#define CONDORCET_INCREMENTAL_H
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include "candidats.h"
+#include "duels.h"
+#include "condorcet.h"
+#include "minimax.h"
+#include "utils.h"
+
+/**
+ * @struct IncrementalCondorcet
+ * @brief État du moteur incrémental.
+ */
+typedef struct IncrementalCondorcet
+{
+    DuelMatrix *duels;          ///< Matrice des duels, possédée par le moteur.
+    CandidateTable *candidates; ///< Table des candidats.
+    int condorcet_winner;       ///< Vainqueur de Condorcet courant, -1 si aucun.
+    ResultatsMinimax *minimax;  ///< Scores et classements des trois variantes de minimax.
+    bool *minimax_dirty;        ///< Candidats dont une pire défaite a pu baisser et doit être recalculée.
+    bool classements_dirty;     ///< Vrai si un score minimax a changé depuis le dernier classement.
+    int *chemins;               ///< Chemins les plus forts de Schulze, tels que calculerCheminsFort les donne.
+    bool chemins_dirty;         ///< Vrai si une marge affaiblie a pu changer un chemin le plus fort.
+    int nb_renforcements;       ///< Arcs renforcés propagés depuis le dernier recalcul complet des chemins.
+    int nb_recalculs_chemins;   ///< Nombre de recalculs complets des chemins depuis la création du moteur.
+} IncrementalCondorcet;
+
+/**
+ * @fn IncrementalCondorcet *createIncrementalCondorcet(CandidateTable *candidates)
+ * @brief Création d'un moteur incrémental sans aucun bulletin.
+ * @param[in] candidates Table des candidats.
+ * @return Moteur incrémental.
+ */
+IncrementalCondorcet *createIncrementalCondorcet(CandidateTable *candidates);
+
+/**
+ * @fn IncrementalCondorcet *createIncrementalCondorcetFromDuels(DuelMatrix *duels, CandidateTable *candidates)
+ * @brief Création d'un moteur incrémental à partir d'une matrice des duels déjà calculée.
+ * @param[in] duels Matrice des duels complète (le moteur en prend possession).
+ * @param[in] candidates Table des candidats.
+ * @return Moteur incrémental.
+ */
+IncrementalCondorcet *createIncrementalCondorcetFromDuels(DuelMatrix *duels, CandidateTable *candidates);
+
+/**
+ * @fn void addBallotIncremental(IncrementalCondorcet *engine, const int *ranks)
+ * @brief Ajout d'un bulletin complet, en O(C²).
+ * @param[in, out] engine Moteur incrémental.
+ * @param[in] ranks Rang donné à chaque candidat (indexé par identifiant, -1 si non classé).
+ */
+void addBallotIncremental(IncrementalCondorcet *engine, const int *ranks);
+
+/**
+ * @fn void addTruncatedBallotIncremental(IncrementalCondorcet *engine, const int *order, int nb_ranked)
+ * @brief Ajout d'un bulletin tronqué, en O(k·C).
+ * @param[in, out] engine Moteur incrémental.
+ * @param[in] order Identifiants des candidats classés, du préféré au moins préféré.
+ * @param[in] nb_ranked Nombre k de candidats classés, les autres sont placés derrière à égalité.
+ */
+void addTruncatedBallotIncremental(IncrementalCondorcet *engine, const int *order, int nb_ranked);
+
+/**
+ * @fn int incrementalCondorcetWinner(IncrementalCondorcet *engine)
+ * @brief Vainqueur de Condorcet courant, en O(1).
+ * @param[in] engine Moteur incrémental.
+ * @return Identifiant du vainqueur de Condorcet, -1 s'il n'existe pas.
+ */
+int incrementalCondorcetWinner(IncrementalCondorcet *engine);
+
+/**
+ * @fn void actualiserIncrementalCondorcet(IncrementalCondorcet *engine)
+ * @brief Recalcule les caches invalidés depuis le dernier appel.
+ * @param[in, out] engine Moteur incrémental.
+ *
+ * @note Après cet appel, les fonctions de résultat ne modifient plus le moteur et peuvent
+ *       s'exécuter en parallèle.
+ */
+void actualiserIncrementalCondorcet(IncrementalCondorcet *engine);
+
+/**
+ * @fn void incrementalMinimaxVariantes(IncrementalCondorcet *engine, FILE *log, bool debugMode, VoteResult *resultats)
+ * @brief Résultats courants des trois variantes de minimax.
+ * @param[in, out] engine Moteur incrémental.
+ * @param[in] log Fichier de log.
+ * @param[in] debugMode Mode debug.
+ * @param[out] resultats Résultat de chaque variante, identique à celui de voteCondorcetMinimaxVariantes.
+ *
+ * @note Seuls les candidats dont une pire défaite a pu baisser sont recalculés, en O(C) chacun.
+ */
+void incrementalMinimaxVariantes(IncrementalCondorcet *engine, FILE *log, bool debugMode, VoteResult *resultats);
+
+/**
+ * @fn VoteResult incrementalSchulze(IncrementalCondorcet *engine, FILE *log, bool debugMode)
+ * @brief Résultat Condorcet Schulze courant.
+ * @param[in, out] engine Moteur incrémental.
+ * @param[in] log Fichier de log.
+ * @param[in] debugMode Mode debug.
+ * @return Structure VoteResult, identique à celle de voteCondorcetSchulzeDuels.
+ *
+ * @note Les chemins ne sont recalculés, en O(C³), que si une marge affaiblie portait le goulet d'un plus
+ *       fort chemin (ce qui comprend un changement de signe) : une marge renforcée est propagée en O(C²),
+ *       et une marge contournée par un chemin strictement plus fort ne change rien.
+ */
+VoteResult incrementalSchulze(IncrementalCondorcet *engine, FILE *log, bool debugMode);
+
+/**
+ * @fn VoteResult incrementalPaires(IncrementalCondorcet *engine, FILE *log, bool debugMode)
+ * @brief Résultat Condorcet des paires courant.
+ * @param[in] engine Moteur incrémental.
+ * @param[in] log Fichier de log.
+ * @param[in] debugMode Mode debug.
+ * @return Structure VoteResult, identique à celle de voteCondorcetPairesDuels.
+ */
+VoteResult incrementalPaires(IncrementalCondorcet *engine, FILE *log, bool debugMode);
+
+/**
+ * @fn void deleteIncrementalCondorcet(IncrementalCondorcet *engine)
+ * @brief Suppression du moteur incrémental et de sa matrice des duels.
+ * @param[in] engine Moteur incrémental.
+ */
+void deleteIncrementalCondorcet(IncrementalCondorcet *engine);
+
+#endif
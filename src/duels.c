@@ -0,0 +1,325 @@
+/**
+ * @file duels.c
+ * @brief Matrice des duels (préférences par paires) partagée par les méthodes Condorcet.
+ * @author Bibyk Bogdan
+ * @date 18 octobre 2026
+ *
+ * Ce fichier contient l'implémentation de la matrice des duels.
+ * Un rang de -1 signifie que l'électeur n'a pas classé le candidat : il est alors
+ * placé derrière tous les candidats classés. En comparant les rangs comme des entiers
+ * non signés, -1 devient la plus grande valeur possible, ce qui évite tout branchement.
+ *
+ */
+
+#ifndef DUELS_C
+#define DUELS_C
+
+#include "duels.h"
+
+/**
+ * @fn static void *allocDuelMem(size_t size)
+ * @brief Fonction d'allocation mémoire initialisée à zéro, avec arrêt du programme en cas d'échec.
+ * @param[in] size Taille à allouer.
+ * @return Pointeur vers la mémoire allouée.
+ */
+static void *allocDuelMem(size_t size)
+{
+    void *ptr = calloc(1, size);
+    if (ptr == NULL)
+    {
+        perror("Erreur d'allocation mémoire");
+        exit(EXIT_FAILURE);
+    }
+    return ptr;
+}
+
+/**
+ * @fn DuelMatrix *createDuelMatrix(int nb_candidates)
+ * @brief Fonction de création d'une matrice des duels vide.
+ * @param[in] nb_candidates Nombre de candidats.
+ * @return Matrice des duels sans aucun bulletin.
+ */
+DuelMatrix *createDuelMatrix(int nb_candidates)
+{
+    DuelMatrix *duels = allocDuelMem(sizeof(DuelMatrix));
+    duels->nb_candidates = nb_candidates;
+    duels->nb_ballots = 0;
+    duels->nb_read = 0;
+    duels->wins = allocDuelMem((size_t)nb_candidates * nb_candidates * sizeof(int) + sizeof(int));
+    return duels;
+}
+
+/**
+ * @fn static void countColumnsDuel(int *ranks_i, int *ranks_j, int nb_rows, int *wins_ij, int *wins_ji)
+ * @brief Compte les préférences entre deux candidats à partir de leurs colonnes de rangs.
+ * @param[in] ranks_i Colonne des rangs du candidat i.
+ * @param[in] ranks_j Colonne des rangs du candidat j.
+ * @param[in] nb_rows Nombre de bulletins.
+ * @param[out] wins_ij Nombre d'électeurs préférant i à j.
+ * @param[out] wins_ji Nombre d'électeurs préférant j à i.
+ */
+static void countColumnsDuel(int *ranks_i, int *ranks_j, int nb_rows, int *wins_ij, int *wins_ji)
+{
+    int ij = 0;
+    int ji = 0;
+    for (int v = 0; v < nb_rows; v++)
+    {
+        unsigned int a = (unsigned int)ranks_i[v];
+        unsigned int b = (unsigned int)ranks_j[v];
+        ij += a < b;
+        ji += b < a;
+    }
+    *wins_ij = ij;
+    *wins_ji = ji;
+}
+
+/**
+ * @fn DuelMatrix *createDuelMatrixFromDf(DataFrame *df, CandidateTable *candidates, bool duel)
+ * @brief Fonction de création de la matrice des duels à partir d'un DataFrame.
+ * @param[in] df DataFrame contenant les bulletins ou une matrice de duels.
+ * @param[in] candidates Table des candidats.
+ * @param[in] duel Indique si le DataFrame est déjà une matrice de duels.
+ * @return Matrice des duels.
+ *
+ * @details Pour une matrice de duels, la case (ligne i, colonne j) est le nombre d'électeurs préférant i à j,
+ *          et le nombre de bulletins est déduit du duel le plus disputé.
+ */
+DuelMatrix *createDuelMatrixFromDf(DataFrame *df, CandidateTable *candidates, bool duel)
+{
+    int nb_candidates = candidates->nb_candidates;
+    DuelMatrix *duels = createDuelMatrix(nb_candidates);
+
+    if (duel)
+    {
+        for (int i = 0; i < nb_candidates; i++)
+            for (int j = 0; j < nb_candidates; j++)
+                DUEL_WINS(duels, i, j) = (i == j) ? 0 : ((int *)df->columns[candidates->columns[j]].data)[i];
+        for (int i = 0; i < nb_candidates; i++)
+            for (int j = i + 1; j < nb_candidates; j++)
+                duels->nb_ballots = max(duels->nb_ballots, DUEL_WINS(duels, i, j) + DUEL_WINS(duels, j, i));
+        duels->nb_read = duels->nb_ballots;
+        return duels;
+    }
+
+    for (int i = 0; i < nb_candidates; i++)
+    {
+        int *ranks_i = (int *)df->columns[candidates->columns[i]].data;
+        for (int j = i + 1; j < nb_candidates; j++)
+        {
+            int *ranks_j = (int *)df->columns[candidates->columns[j]].data;
+            countColumnsDuel(ranks_i, ranks_j, df->num_rows, &DUEL_WINS(duels, i, j), &DUEL_WINS(duels, j, i));
+        }
+    }
+    duels->nb_ballots = df->num_rows;
+    duels->nb_read = df->num_rows;
+    return duels;
+}
+
+/**
+ * @fn DuelMatrix *tallyBallots(DataFrame *df, CandidateTable *candidates, int *firstPreferences)
+ * @brief Dépouillement des bulletins en un seul passage : premières places et matrice des duels.
+ * @param[in] df DataFrame contenant les bulletins.
+ * @param[in] candidates Table des candidats.
+ * @param[out] firstPreferences Nombre de premières places de chaque candidat.
+ * @return Matrice des duels.
+ */
+DuelMatrix *tallyBallots(DataFrame *df, CandidateTable *candidates, int *firstPreferences)
+{
+    int nb_candidates = candidates->nb_candidates;
+    DuelMatrix *duels = createDuelMatrix(nb_candidates);
+    int *columns[nb_candidates + 1];
+    int ranks[nb_candidates + 1];
+    for (int c = 0; c < nb_candidates; c++)
+    {
+        columns[c] = (int *)df->columns[candidates->columns[c]].data;
+        firstPreferences[c] = 0;
+    }
+
+    for (int v = 0; v < df->num_rows; v++)
+    {
+        for (int c = 0; c < nb_candidates; c++)
+        {
+            ranks[c] = columns[c][v];
+            firstPreferences[c] += ranks[c] == 1;
+        }
+        addBallot(duels, ranks);
+    }
+    return duels;
+}
+
+/**
+ * @fn DuelMatrix *extractDuelMatrix(DuelMatrix *duels, const int *ids, int nb_ids)
+ * @brief Fonction d'extraction de la matrice des duels restreinte à un sous-ensemble de candidats.
+ * @param[in] duels Matrice des duels.
+ * @param[in] ids Identifiants des candidats conservés.
+ * @param[in] nb_ids Nombre de candidats conservés.
+ * @return Matrice des duels dont le candidat k correspond au candidat ids[k].
+ */
+DuelMatrix *extractDuelMatrix(DuelMatrix *duels, const int *ids, int nb_ids)
+{
+    DuelMatrix *sub = createDuelMatrix(nb_ids);
+    sub->nb_ballots = duels->nb_ballots;
+    sub->nb_read = duels->nb_read;
+    for (int a = 0; a < nb_ids; a++)
+        for (int b = 0; b < nb_ids; b++)
+            DUEL_WINS(sub, a, b) = DUEL_WINS(duels, ids[a], ids[b]);
+    return sub;
+}
+
+/**
+ * @fn void addBallot(DuelMatrix *duels, const int *ranks)
+ * @brief Ajout d'un bulletin complet à la matrice des duels, en O(C²).
+ * @param[in, out] duels Matrice des duels.
+ * @param[in] ranks Rang donné à chaque candidat (indexé par identifiant, -1 si non classé).
+ */
+void addBallot(DuelMatrix *duels, const int *ranks)
+{
+    int nb_candidates = duels->nb_candidates;
+    for (int i = 0; i < nb_candidates; i++)
+    {
+        unsigned int a = (unsigned int)ranks[i];
+        int *row = &duels->wins[i * nb_candidates];
+        for (int j = 0; j < nb_candidates; j++)
+            row[j] += a < (unsigned int)ranks[j];
+    }
+    duels->nb_ballots++;
+    duels->nb_read++;
+}
+
+/**
+ * @fn void addTruncatedBallot(DuelMatrix *duels, const int *order, int nb_ranked)
+ * @brief Ajout d'un bulletin tronqué à la matrice des duels, en O(k·C).
+ * @param[in, out] duels Matrice des duels.
+ * @param[in] order Identifiants des candidats classés, du préféré au moins préféré.
+ * @param[in] nb_ranked Nombre k de candidats classés, les autres sont placés derrière à égalité.
+ */
+void addTruncatedBallot(DuelMatrix *duels, const int *order, int nb_ranked)
+{
+    int nb_candidates = duels->nb_candidates;
+    bool placed[nb_candidates];
+    memset(placed, 0, sizeof(placed));
+
+    // Chaque candidat classé bat tous les candidats qui ne sont pas encore placés
+    for (int p = 0; p < nb_ranked; p++)
+    {
+        int a = order[p];
+        placed[a] = true;
+        int *row = &duels->wins[a * nb_candidates];
+        for (int j = 0; j < nb_candidates; j++)
+            row[j] += !placed[j];
+    }
+    duels->nb_ballots++;
+    duels->nb_read++;
+}
+
+/**
+ * @fn int findCondorcetWinner(DuelMatrix *duels)
+ * @brief Recherche du vainqueur de Condorcet, en O(C).
+ * @param[in] duels Matrice des duels.
+ * @return Identifiant du candidat qui bat tous les autres, -1 s'il n'existe pas.
+ */
+int findCondorcetWinner(DuelMatrix *duels)
+{
+    return findLockedCondorcetWinner(duels, 0);
+}
+
+/**
+ * @fn int findLockedCondorcetWinner(DuelMatrix *duels, int remaining)
+ * @brief Recherche d'un vainqueur de Condorcet que des bulletins supplémentaires ne peuvent plus renverser, en O(C).
+ * @param[in] duels Matrice des duels.
+ * @param[in] remaining Nombre de bulletins restant à compter.
+ * @return Identifiant du candidat qui bat tous les autres avec une marge supérieure à remaining, -1 s'il n'existe pas.
+ *
+ * @details Un seul passage élimine tous les candidats sauf un : tout candidat dont la marge contre le suivant
+ *          ne dépasse pas remaining ne peut pas convenir. Il reste à vérifier le survivant.
+ */
+int findLockedCondorcetWinner(DuelMatrix *duels, int remaining)
+{
+    int nb_candidates = duels->nb_candidates;
+    if (nb_candidates == 0)
+        return -1;
+
+    int survivant = 0;
+    for (int j = 1; j < nb_candidates; j++)
+    {
+        if (DUEL_MARGIN(duels, survivant, j) <= remaining)
+            survivant = j;
+    }
+    for (int j = 0; j < nb_candidates; j++)
+    {
+        if (j != survivant && DUEL_MARGIN(duels, survivant, j) <= remaining)
+            return -1;
+    }
+    return survivant;
+}
+
+/**
+ * @fn DuelMatrix *createDuelMatrixFromDfEarlyExit(DataFrame *df, CandidateTable *candidates)
+ * @brief Fonction de création de la matrice des duels, arrêtée dès que le vainqueur de Condorcet est acquis.
+ * @param[in] df DataFrame contenant les bulletins.
+ * @param[in] candidates Table des candidats.
+ * @return Matrice des duels des bulletins lus : nb_read bulletins comptés sur nb_ballots.
+ *
+ * @details Les bulletins sont comptés un par un. Après chacun, on vérifie en O(C) si un candidat bat
+ *          tous les autres avec une marge supérieure au nombre de bulletins restants.
+ */
+DuelMatrix *createDuelMatrixFromDfEarlyExit(DataFrame *df, CandidateTable *candidates)
+{
+    int nb_candidates = candidates->nb_candidates;
+    DuelMatrix *duels = createDuelMatrix(nb_candidates);
+    int *columns[nb_candidates + 1];
+    int ranks[nb_candidates + 1];
+    for (int c = 0; c < nb_candidates; c++)
+        columns[c] = (int *)df->columns[candidates->columns[c]].data;
+
+    for (int v = 0; v < df->num_rows; v++)
+    {
+        for (int c = 0; c < nb_candidates; c++)
+            ranks[c] = columns[c][v];
+        addBallot(duels, ranks);
+        if (findLockedCondorcetWinner(duels, df->num_rows - v - 1) != -1)
+            break;
+    }
+    duels->nb_ballots = df->num_rows;
+    return duels;
+}
+
+/**
+ * @fn void printDuelMatrix(DuelMatrix *duels, CandidateTable *candidates, FILE *file)
+ * @brief Affichage de la matrice des duels.
+ * @param[in] duels Matrice des duels.
+ * @param[in] candidates Table des candidats.
+ * @param[out] file Fichier de sortie.
+ */
+void printDuelMatrix(DuelMatrix *duels, CandidateTable *candidates, FILE *file)
+{
+    fprintf(file, "    |");
+    for (int j = 0; j < duels->nb_candidates; j++)
+        fprintf(file, "  %c |", candidates->letters[j]);
+    fprintf(file, "     Légende :\n");
+    for (int i = 0; i < duels->nb_candidates; i++)
+    {
+        fprintf(file, "  %c |", candidates->letters[i]);
+        for (int j = 0; j < duels->nb_candidates; j++)
+        {
+            if (i == j)
+                fprintf(file, "  - |");
+            else
+                fprintf(file, "%4d|", DUEL_WINS(duels, i, j));
+        }
+        fprintf(file, "        %c : %s\n", candidates->letters[i], candidates->names[i]);
+    }
+}
+
+/**
+ * @fn void deleteDuelMatrix(DuelMatrix *duels)
+ * @brief Suppression de la matrice des duels.
+ * @param[in] duels Matrice des duels.
+ */
+void deleteDuelMatrix(DuelMatrix *duels)
+{
+    free(duels->wins);
+    free(duels);
+}
+
+#endif // DUELS_C
@@ -0,0 +1,155 @@
+/**
+ * @file duels.h
+ * @brief Matrice des duels (préférences par paires) partagée par les méthodes Condorcet.
+ * @author Bibyk Bogdan
+ * @date 18 octobre 2026
+ *
+ * Ce fichier d'en-tête définit la matrice des duels : pour chaque paire de candidats (i, j),
+ * le nombre d'électeurs qui préfèrent i à j. Elle est calculée une seule fois à partir
+ * des bulletins (ou lue directement depuis une matrice de duels) ; addBallot et addTruncatedBallot
+ * y ajoutent ensuite un bulletin à la fois.
+ *
+ */
+
+#ifndef DUELS_H
+#define DUELS_H
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include "lecture_csv.h"
+#include "candidats.h"
+#include "utils.h"
+
+/**
+ * @struct DuelMatrix
+ * @brief Matrice des duels entre candidats, stockée en ligne-majeure dans un seul bloc.
+ */
+typedef struct DuelMatrix
+{
+    int nb_candidates; ///< Nombre de candidats.
+    int nb_ballots;    ///< Nombre de bulletins du scrutin.
+    int nb_read;       ///< Nombre de bulletins comptés, inférieur à nb_ballots en cas d'arrêt anticipé.
+    int *wins;         ///< wins[i * nb_candidates + j] : nombre d'électeurs préférant i à j.
+} DuelMatrix;
+
+/**
+ * @def DUEL_WINS(duels, i, j)
+ * @brief Nombre d'électeurs préférant le candidat i au candidat j.
+ */
+#define DUEL_WINS(duels, i, j) ((duels)->wins[(i) * (duels)->nb_candidates + (j)])
+
+/**
+ * @def DUEL_MARGIN(duels, i, j)
+ * @brief Marge du duel entre i et j (positive si i bat j).
+ */
+#define DUEL_MARGIN(duels, i, j) (DUEL_WINS(duels, i, j) - DUEL_WINS(duels, j, i))
+
+/**
+ * @fn DuelMatrix *createDuelMatrix(int nb_candidates)
+ * @brief Fonction de création d'une matrice des duels vide.
+ * @param[in] nb_candidates Nombre de candidats.
+ * @return Matrice des duels sans aucun bulletin.
+ */
+DuelMatrix *createDuelMatrix(int nb_candidates);
+
+/**
+ * @fn DuelMatrix *createDuelMatrixFromDf(DataFrame *df, CandidateTable *candidates, bool duel)
+ * @brief Fonction de création de la matrice des duels à partir d'un DataFrame.
+ * @param[in] df DataFrame contenant les bulletins ou une matrice de duels.
+ * @param[in] candidates Table des candidats.
+ * @param[in] duel Indique si le DataFrame est déjà une matrice de duels.
+ * @return Matrice des duels.
+ *
+ * @note Pour des bulletins, chaque paire de colonnes de rangs est parcourue une seule fois, en O(V·C²/2).
+ */
+DuelMatrix *createDuelMatrixFromDf(DataFrame *df, CandidateTable *candidates, bool duel);
+
+/**
+ * @fn DuelMatrix *tallyBallots(DataFrame *df, CandidateTable *candidates, int *firstPreferences)
+ * @brief Dépouillement des bulletins en un seul passage : premières places et matrice des duels.
+ * @param[in] df DataFrame contenant les bulletins.
+ * @param[in] candidates Table des candidats.
+ * @param[out] firstPreferences Nombre de premières places de chaque candidat (nb_candidates cases).
+ * @return Matrice des duels.
+ *
+ * @note Chaque bulletin n'est lu qu'une fois, en O(V·C²) : c'est tout ce dont ont besoin le scrutin
+ *       à deux tours (premier tour et duel du second tour) et les méthodes Condorcet.
+ */
+DuelMatrix *tallyBallots(DataFrame *df, CandidateTable *candidates, int *firstPreferences);
+
+/**
+ * @fn DuelMatrix *extractDuelMatrix(DuelMatrix *duels, const int *ids, int nb_ids)
+ * @brief Fonction d'extraction de la matrice des duels restreinte à un sous-ensemble de candidats.
+ * @param[in] duels Matrice des duels.
+ * @param[in] ids Identifiants des candidats conservés.
+ * @param[in] nb_ids Nombre de candidats conservés.
+ * @return Matrice des duels dont le candidat k correspond au candidat ids[k].
+ */
+DuelMatrix *extractDuelMatrix(DuelMatrix *duels, const int *ids, int nb_ids);
+
+/**
+ * @fn void addBallot(DuelMatrix *duels, const int *ranks)
+ * @brief Ajout d'un bulletin complet à la matrice des duels, en O(C²).
+ * @param[in, out] duels Matrice des duels.
+ * @param[in] ranks Rang donné à chaque candidat (indexé par identifiant, -1 si non classé).
+ */
+void addBallot(DuelMatrix *duels, const int *ranks);
+
+/**
+ * @fn void addTruncatedBallot(DuelMatrix *duels, const int *order, int nb_ranked)
+ * @brief Ajout d'un bulletin tronqué à la matrice des duels, en O(k·C).
+ * @param[in, out] duels Matrice des duels.
+ * @param[in] order Identifiants des candidats classés, du préféré au moins préféré.
+ * @param[in] nb_ranked Nombre k de candidats classés, les autres sont placés derrière à égalité.
+ */
+void addTruncatedBallot(DuelMatrix *duels, const int *order, int nb_ranked);
+
+/**
+ * @fn int findCondorcetWinner(DuelMatrix *duels)
+ * @brief Recherche du vainqueur de Condorcet, en O(C).
+ * @param[in] duels Matrice des duels.
+ * @return Identifiant du candidat qui bat tous les autres, -1 s'il n'existe pas.
+ */
+int findCondorcetWinner(DuelMatrix *duels);
+
+/**
+ * @fn int findLockedCondorcetWinner(DuelMatrix *duels, int remaining)
+ * @brief Recherche d'un vainqueur de Condorcet que des bulletins supplémentaires ne peuvent plus renverser, en O(C).
+ * @param[in] duels Matrice des duels.
+ * @param[in] remaining Nombre de bulletins restant à compter.
+ * @return Identifiant du candidat qui bat tous les autres avec une marge supérieure à remaining, -1 s'il n'existe pas.
+ */
+int findLockedCondorcetWinner(DuelMatrix *duels, int remaining);
+
+/**
+ * @fn DuelMatrix *createDuelMatrixFromDfEarlyExit(DataFrame *df, CandidateTable *candidates)
+ * @brief Fonction de création de la matrice des duels, arrêtée dès que le vainqueur de Condorcet est acquis.
+ * @param[in] df DataFrame contenant les bulletins.
+ * @param[in] candidates Table des candidats.
+ * @return Matrice des duels des bulletins lus : nb_read bulletins comptés sur nb_ballots.
+ *
+ * @note La matrice est partielle : les méthodes qui respectent le critère de Condorcet (minimax par marges
+ *       ou votes gagnants, paires, Schulze) donnent le même vainqueur que sur tous les bulletins,
+ *       ce n'est pas garanti pour minimax par opposition.
+ */
+DuelMatrix *createDuelMatrixFromDfEarlyExit(DataFrame *df, CandidateTable *candidates);
+
+/**
+ * @fn void printDuelMatrix(DuelMatrix *duels, CandidateTable *candidates, FILE *file)
+ * @brief Affichage de la matrice des duels.
+ * @param[in] duels Matrice des duels.
+ * @param[in] candidates Table des candidats.
+ * @param[out] file Fichier de sortie.
+ */
+void printDuelMatrix(DuelMatrix *duels, CandidateTable *candidates, FILE *file);
+
+/**
+ * @fn void deleteDuelMatrix(DuelMatrix *duels)
+ * @brief Suppression de la matrice des duels.
+ * @param[in] duels Matrice des duels.
+ */
+void deleteDuelMatrix(DuelMatrix *duels);
+
+#endif
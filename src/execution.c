@@ -0,0 +1,542 @@
+/**
+ * @file execution.c
+ * @brief Préparation d'une élection et exécution concurrente des méthodes de vote.
+ * @author Bibyk Bogdan
+ * @date 18 octobre 2026
+ *
+ * Ce fichier contient l'implémentation de l'exécution d'une liste de méthodes.
+ * Les threads ne partagent que des données en lecture seule ; les sorties de chaque méthode sont
+ * écrites dans des flux en mémoire (open_memstream) puis recopiées dans un ordre fixe, si bien que
+ * l'affichage est identique à une exécution séquentielle.
+ *
+ */
+
+#ifndef EXECUTION_C
+#define EXECUTION_C
+
+#include <string.h>
+#include <pthread.h>
+#include "execution.h"
+#include "condorcet.h"
+#include "jugement_majoritaire.h"
+#include "uninominales.h"
+#include "stv.h"
+#include "lecture_duels.h"
+#include "utils.h"
+#include "statistiques.h"
+
+/**
+ * @struct Tache
+ * @brief Méthode exécutée par un thread, avec ses tampons de sortie.
+ */
+typedef struct Tache
+{
+    char *methode;          ///< Nom de la méthode.
+    Election *election;     ///< Élection partagée, en lecture seule.
+    OptionsScrutin *options;///< Options du scrutin.
+    char *sortie;           ///< Résultats écrits par la méthode.
+    size_t tailleSortie;    ///< Taille des résultats.
+    char *journal;          ///< Log écrit par la méthode.
+    size_t tailleJournal;   ///< Taille du log.
+} Tache;
+
+/**
+ * @fn static bool estMethode(char *methode, char *noms[], int nbNoms)
+ * @brief Indique si une méthode fait partie d'une liste de noms.
+ * @param[in] methode Nom de la méthode.
+ * @param[in] noms Liste de noms.
+ * @param[in] nbNoms Taille de la liste.
+ * @return true si la méthode est dans la liste.
+ */
+static bool estMethode(char *methode, char *noms[], int nbNoms)
+{
+    for (int i = 0; i < nbNoms; i++)
+    {
+        if (strcmp(methode, noms[i]) == 0)
+            return true;
+    }
+    return false;
+}
+
+/**
+ * @fn int listerMethodes(char *method, bool duel, char **methodes)
+ * @brief Découpe une liste de méthodes séparées par des virgules, "all" étant remplacé par toutes les méthodes disponibles.
+ * @param[in, out] method Liste des méthodes (modifiée par le découpage).
+ * @param[in] duel Indique si l'élection est chargée depuis une matrice de duels.
+ * @param[out] methodes Noms des méthodes, dans l'ordre d'affichage (MAX_METHODES cases).
+ * @return Nombre de méthodes.
+ */
+int listerMethodes(char *method, bool duel, char **methodes)
+{
+    // Ordre d'affichage historique de "all"
+    static char *toutesBulletins[] = {"uni1", "uni2", "jm", "irv", "borda", "dowdall", "anti", "bucklin", "cm", "cp", "cs"};
+    static char *toutesDuels[] = {"cm", "cp", "cs"};
+    char **toutes = duel ? toutesDuels : toutesBulletins;
+    int nbToutes = duel ? 3 : 11;
+
+    int nb = 0;
+    char *suite;
+    for (char *jeton = strtok_r(method, ",", &suite); jeton != NULL; jeton = strtok_r(NULL, ",", &suite))
+    {
+        if (strcmp(jeton, "all") == 0)
+        {
+            for (int i = 0; i < nbToutes && nb < MAX_METHODES; i++)
+                methodes[nb++] = toutes[i];
+        }
+        else if (nb < MAX_METHODES)
+            methodes[nb++] = jeton;
+    }
+    return nb;
+}
+
+/**
+ * @fn bool methodeValide(char *methode, bool duel)
+ * @brief Indique si une méthode est disponible.
+ * @param[in] methode Nom de la méthode.
+ * @param[in] duel Indique si l'élection est chargée depuis une matrice de duels.
+ * @return true si la méthode peut être exécutée.
+ */
+bool methodeValide(char *methode, bool duel)
+{
+    static char *bulletins[] = {"uni1", "uni2", "cm", "cp", "cs", "jm", "irv", "stv", "borda", "dowdall", "anti", "bucklin", "all"};
+    static char *duels[] = {"cm", "cp", "cs", "all"};
+    return duel ? estMethode(methode, duels, 4) : estMethode(methode, bulletins, 13);
+}
+
+/**
+ * @fn bool chargerElection(Election *election, char *chemin, bool duel)
+ * @brief Charge une élection depuis un fichier de bulletins ou une matrice de duels.
+ * @param[out] election Élection, sans structure dérivée.
+ * @param[in] chemin Chemin du fichier.
+ * @param[in] duel Indique si le fichier est une matrice de duels.
+ * @return false si le fichier est illisible, mal formé ou sans candidat (voir erreurLecture()).
+ */
+bool chargerElection(Election *election, char *chemin, bool duel)
+{
+    *election = (Election){0};
+    STATS_DEBUT(debut);
+    if (duel)
+    {
+        // Charger la matrice de duels directement, sans passer par un DataFrame
+        election->duels = readDuelMatrixCsv(chemin, &election->duelNames);
+        if (election->duels != NULL)
+            election->candidates = createCandidateTableFromNames(election->duelNames, election->duels->nb_candidates);
+    }
+    else
+    {
+        // Créer une structure de données DataFrame à partir du fichier CSV passé,
+        // puis la table des candidats partagée par toutes les méthodes
+        election->df = createDataFrameFromCsv(chemin);
+        if (election->df != NULL)
+            election->candidates = createCandidateTable(election->df, false);
+    }
+    STATS_FIN(debut, "chargement");
+    if (election->candidates == NULL)
+        return false;
+    if (election->candidates->nb_candidates == 0)
+    {
+        signalerErreurLecture("%s : aucun candidat", chemin);
+        fermerElection(election);
+        return false;
+    }
+    STATS_AJOUTER(STAT_FICHIERS, 1);
+    return true;
+}
+
+/**
+ * @fn static int comparerRangs(const void *a, const void *b)
+ * @brief Comparaison de deux candidats classés (rang puis identifiant) pour qsort.
+ */
+static int comparerRangs(const void *a, const void *b)
+{
+    const int *x = a;
+    const int *y = b;
+    return x[0] != y[0] ? (x[0] > y[0]) - (x[0] < y[0]) : (x[1] > y[1]) - (x[1] < y[1]);
+}
+
+/**
+ * @fn void ajouterBulletinElection(Election *election, const int *rangs)
+ * @brief Ajoute un bulletin à une élection chargée, en ne mettant à jour que les méthodes Condorcet.
+ * @param[in, out] election Élection.
+ * @param[in] rangs Rang donné à chaque candidat (indexé par identifiant, -1 si non classé).
+ */
+void ajouterBulletinElection(Election *election, const int *rangs)
+{
+    int nb_candidates = election->candidates->nb_candidates;
+    if (election->incremental == NULL)
+    {
+        // Une matrice partagée avec le dépouillement ou arrêtée avant la fin ne peut pas être reprise telle quelle
+        DuelMatrix *duels = election->duels;
+        if (duels == NULL || duels == election->depouillement || duels->nb_read < duels->nb_ballots)
+        {
+            if (duels != NULL && duels != election->depouillement)
+                deleteDuelMatrix(duels);
+            duels = createDuelMatrixFromDf(election->df, election->candidates, false);
+        }
+        election->incremental = createIncrementalCondorcetFromDuels(duels, election->candidates);
+        election->duels = duels;
+    }
+
+    // Un bulletin sans égalité se compte à partir de l'ordre de ses k candidats classés, en O(k·C)
+    int classes[nb_candidates + 1][2];
+    int nb_classes = 0;
+    for (int c = 0; c < nb_candidates; c++)
+    {
+        if (rangs[c] >= 1)
+        {
+            classes[nb_classes][0] = rangs[c];
+            classes[nb_classes][1] = c;
+            nb_classes++;
+        }
+    }
+    qsort(classes, nb_classes, sizeof(classes[0]), comparerRangs);
+
+    int ordre[nb_candidates + 1];
+    bool egalite = false;
+    for (int k = 0; k < nb_classes; k++)
+    {
+        ordre[k] = classes[k][1];
+        egalite |= k > 0 && classes[k][0] == classes[k - 1][0];
+    }
+    if (egalite)
+        addBallotIncremental(election->incremental, rangs);
+    else
+        addTruncatedBallotIncremental(election->incremental, ordre, nb_classes);
+}
+
+/**
+ * @fn void preparerElection(Election *election, char **methodes, int nbMethodes, OptionsScrutin *options)
+ * @brief Calcule une seule fois les structures partagées nécessaires aux méthodes demandées.
+ * @param[in, out] election Élection, dont df (ou duels) et candidates sont déjà renseignés.
+ * @param[in] methodes Noms des méthodes.
+ * @param[in] nbMethodes Nombre de méthodes.
+ * @param[in] options Options du scrutin.
+ */
+void preparerElection(Election *election, char **methodes, int nbMethodes, OptionsScrutin *options)
+{
+    char *condorcet[] = {"cm", "cp", "cs"};
+    char *positionnelles[] = {"borda", "dowdall", "anti", "bucklin"};
+    char *deuxTours[] = {"uni2"};
+    bool besoinDuels = false;
+    bool besoinHisto = false;
+    bool besoinDepouillement = false;
+    for (int i = 0; i < nbMethodes; i++)
+    {
+        besoinDuels |= estMethode(methodes[i], condorcet, 3);
+        besoinHisto |= estMethode(methodes[i], positionnelles, 4);
+        besoinDepouillement |= estMethode(methodes[i], deuxTours, 1);
+    }
+
+    // Le scrutin à deux tours dépouille les bulletins en un seul passage : premières places et matrice des duels
+    if (election->df != NULL && besoinDepouillement && election->depouillement == NULL)
+    {
+        election->premieresPlaces = malloc((election->candidates->nb_candidates + 1) * sizeof(int));
+        if (election->premieresPlaces == NULL)
+        {
+            perror("Erreur d'allocation mémoire");
+            exit(EXIT_FAILURE);
+        }
+        STATS_DEBUT(debut);
+        election->depouillement = tallyBallots(election->df, election->candidates, election->premieresPlaces);
+        STATS_FIN(debut, "comptage");
+    }
+
+    // Les méthodes Condorcet partagent la matrice des duels, calculée une seule fois à partir des bulletins
+    if (election->df != NULL && besoinDuels && election->duels == NULL)
+    {
+        STATS_DEBUT(debut);
+        if (options->earlyExit)
+        {
+            // En mode arrêt anticipé, le décompte s'arrête dès que le vainqueur de Condorcet est acquis
+            election->duels = createDuelMatrixFromDfEarlyExit(election->df, election->candidates);
+        }
+        else if (election->depouillement != NULL)
+        {
+            election->duels = election->depouillement;
+        }
+        else
+        {
+            election->duels = createDuelMatrixFromDf(election->df, election->candidates, false);
+        }
+        STATS_FIN(debut, "duels");
+    }
+
+    // Les caches du moteur incrémental sont remis à jour avant que les threads ne les lisent
+    if (election->incremental != NULL && besoinDuels)
+        actualiserIncrementalCondorcet(election->incremental);
+
+    // Toutes les méthodes positionnelles se déduisent du même histogramme
+    if (election->df != NULL && besoinHisto && election->histo == NULL)
+    {
+        STATS_DEBUT(debut);
+        election->histo = createHistogramme(election->df, election->candidates);
+        STATS_FIN(debut, "histogramme");
+    }
+}
+
+/**
+ * @fn static int ajouterResultat(ResultatMethode *resultats, int nb, VoteResult resultat, char *libelle, int tour)
+ * @brief Ajoute un résultat à la liste d'une méthode.
+ * @param[out] resultats Liste des résultats.
+ * @param[in] nb Nombre de résultats déjà dans la liste.
+ * @param[in] resultat Résultat.
+ * @param[in] libelle Libellé affiché.
+ * @param[in] tour Tour ou rang du résultat.
+ * @return Nouveau nombre de résultats.
+ */
+static int ajouterResultat(ResultatMethode *resultats, int nb, VoteResult resultat, char *libelle, int tour)
+{
+    resultats[nb] = (ResultatMethode){libelle, tour, resultat};
+    return nb + 1;
+}
+
+/**
+ * @fn int calculerMethode(char *methode, Election *election, OptionsScrutin *options, FILE *log, ResultatMethode *resultats)
+ * @brief Exécute une méthode et renvoie ses résultats dans l'ordre d'affichage.
+ * @param[in] methode Nom de la méthode.
+ * @param[in] election Élection préparée.
+ * @param[in] options Options du scrutin.
+ * @param[out] log Fichier de log.
+ * @param[out] resultats Résultats (nbResultatsMax(options) cases).
+ * @return Nombre de résultats.
+ */
+int calculerMethode(char *methode, Election *election, OptionsScrutin *options, FILE *log, ResultatMethode *resultats)
+{
+    DataFrame *df = election->df;
+    CandidateTable *candidates = election->candidates;
+    DuelMatrix *duels = election->duels;
+    bool debugMode = options->debugMode;
+    int nb = 0;
+    STATS_DEBUT(debut);
+
+    if (strcmp(methode, "uni1") == 0)
+    {
+        // Exécuter le vote uninominal à un tour
+        if (options->earlyExit)
+            nb = ajouterResultat(resultats, nb, voteUninominalUnTourAnticipe(df, candidates, log, debugMode), "uni1", 1);
+        else
+            nb = ajouterResultat(resultats, nb, voteUninominalUnTour(df, candidates, log, debugMode, -1), "uni1", 1);
+    }
+    else if (strcmp(methode, "uni2") == 0)
+    {
+        // Exécuter le vote uninominal à deux tours
+        VoteResult firstTourFirstCandidate;
+        VoteResult firstTourSecondCandidate;
+        VoteResult secondTour;
+        bool majorite;
+        voteUninominalDeuxToursDuels(election->depouillement, election->premieresPlaces, candidates, log, debugMode,
+                                     &firstTourFirstCandidate, &firstTourSecondCandidate, &secondTour, &majorite);
+        nb = ajouterResultat(resultats, nb, firstTourFirstCandidate, "uni2", 1);
+        if (!majorite)
+            nb = ajouterResultat(resultats, nb, firstTourSecondCandidate, "uni2", 1);
+        nb = ajouterResultat(resultats, nb, secondTour, "uni2", 2);
+    }
+    else if (strcmp(methode, "cm") == 0)
+    {
+        // Exécuter le vote Condorcet Minimax, dans ses trois variantes calculées ensemble
+        VoteResult variantes[NB_VARIANTES_MINIMAX];
+        if (election->incremental != NULL)
+            incrementalMinimaxVariantes(election->incremental, log, debugMode, variantes);
+        else
+            voteCondorcetMinimaxVariantes(duels, candidates, log, debugMode, variantes);
+        nb = ajouterResultat(resultats, nb, variantes[MINIMAX_MARGES], "cm", 1);
+        nb = ajouterResultat(resultats, nb, variantes[MINIMAX_VOTES_GAGNANTS], "cmv", 1);
+        // Sur un décompte arrêté avant la fin, seul le vainqueur de Condorcet est acquis :
+        // la variante par opposition, qui peut ne pas l'élire, n'est pas fiable
+        if (duels->nb_read == duels->nb_ballots)
+            nb = ajouterResultat(resultats, nb, variantes[MINIMAX_OPPOSITION], "cmo", 1);
+    }
+    else if (strcmp(methode, "cp") == 0)
+    {
+        // Exécuter le vote Condorcet Paires
+        VoteResult result = election->incremental != NULL ? incrementalPaires(election->incremental, log, debugMode)
+                                                          : voteCondorcetPairesDuels(duels, candidates, log, debugMode);
+        nb = ajouterResultat(resultats, nb, result, "cp", 1);
+    }
+    else if (strcmp(methode, "cs") == 0)
+    {
+        // Exécuter le vote Condorcet Schulze
+        VoteResult result = election->incremental != NULL ? incrementalSchulze(election->incremental, log, debugMode)
+                                                          : voteCondorcetSchulzeDuels(duels, candidates, log, debugMode);
+        nb = ajouterResultat(resultats, nb, result, "cs", 1);
+    }
+    else if (strcmp(methode, "jm") == 0)
+    {
+        // Exécuter le vote Jugement Majoritaire
+        nb = ajouterResultat(resultats, nb, voteJugementMajoritaire(df, candidates, options->echelle, log, debugMode), "jm", 1);
+    }
+    else if (strcmp(methode, "irv") == 0)
+    {
+        // Exécuter le vote alternatif
+        nb = ajouterResultat(resultats, nb, voteAlternatif(df, candidates, log, debugMode), "irv", 1);
+    }
+    else if (strcmp(methode, "stv") == 0)
+    {
+        // Exécuter le vote unique transférable
+        VoteResult elus[options->nbSieges];
+        int nbElus = voteUniqueTransferable(df, candidates, options->nbSieges, log, debugMode, elus);
+        for (int i = 0; i < nbElus; i++)
+            nb = ajouterResultat(resultats, nb, elus[i], "stv", i + 1);
+    }
+    else if (strcmp(methode, "borda") == 0)
+    {
+        nb = ajouterResultat(resultats, nb, voteBorda(election->histo, candidates, log, debugMode), "borda", 1);
+    }
+    else if (strcmp(methode, "dowdall") == 0)
+    {
+        nb = ajouterResultat(resultats, nb, voteDowdall(election->histo, candidates, log, debugMode), "dowdall", 1);
+    }
+    else if (strcmp(methode, "anti") == 0)
+    {
+        nb = ajouterResultat(resultats, nb, voteAntiPluralite(election->histo, candidates, log, debugMode), "anti", 1);
+    }
+    else if (strcmp(methode, "bucklin") == 0)
+    {
+        int tour;
+        VoteResult result = voteBucklin(election->histo, candidates, log, debugMode, &tour);
+        nb = ajouterResultat(resultats, nb, result, "bucklin", tour);
+    }
+    STATS_FIN(debut, methode);
+    return nb;
+}
+
+/**
+ * @fn static void executerMethode(char *methode, Election *election, OptionsScrutin *options, FILE *out, FILE *log)
+ * @brief Exécute une méthode et écrit ses résultats.
+ * @param[in] methode Nom de la méthode.
+ * @param[in] election Élection préparée.
+ * @param[in] options Options du scrutin.
+ * @param[out] out Fichier des résultats.
+ * @param[out] log Fichier de log.
+ */
+static void executerMethode(char *methode, Election *election, OptionsScrutin *options, FILE *out, FILE *log)
+{
+    ResultatMethode resultats[nbResultatsMax(options)];
+    int nb = calculerMethode(methode, election, options, log, resultats);
+    for (int i = 0; i < nb; i++)
+        fprintResult(out, resultats[i].resultat, resultats[i].libelle, resultats[i].tour);
+}
+
+/**
+ * @fn static FILE *ouvrirTampon(char **tampon, size_t *taille)
+ * @brief Ouvre un flux d'écriture en mémoire.
+ * @param[out] tampon Contenu du flux, disponible après sa fermeture.
+ * @param[out] taille Taille du contenu.
+ * @return Flux ouvert.
+ */
+static FILE *ouvrirTampon(char **tampon, size_t *taille)
+{
+    FILE *fp = open_memstream(tampon, taille);
+    if (fp == NULL)
+    {
+        perror("open_memstream");
+        exit(EXIT_FAILURE);
+    }
+    return fp;
+}
+
+/**
+ * @fn static void *executerTache(void *arg)
+ * @brief Point d'entrée d'un thread : exécute une méthode dans ses propres tampons.
+ * @param[in, out] arg Tâche à exécuter.
+ * @return NULL.
+ */
+static void *executerTache(void *arg)
+{
+    Tache *tache = arg;
+    FILE *out = ouvrirTampon(&tache->sortie, &tache->tailleSortie);
+    FILE *log = tache->options->debugMode ? ouvrirTampon(&tache->journal, &tache->tailleJournal) : NULL;
+
+    executerMethode(tache->methode, tache->election, tache->options, out, log);
+
+    fclose(out);
+    if (log != NULL)
+        fclose(log);
+    return NULL;
+}
+
+/**
+ * @fn void executerMethodes(Election *election, char **methodes, int nbMethodes, OptionsScrutin *options, FILE *out, FILE *log)
+ * @brief Exécute les méthodes demandées, chacune dans son thread, et écrit leurs résultats dans l'ordre de la liste.
+ * @param[in] election Élection préparée.
+ * @param[in] methodes Noms des méthodes.
+ * @param[in] nbMethodes Nombre de méthodes.
+ * @param[in] options Options du scrutin.
+ * @param[out] out Fichier des résultats.
+ * @param[out] log Fichier de log, utilisé seulement en mode debug.
+ */
+void executerMethodes(Election *election, char **methodes, int nbMethodes, OptionsScrutin *options, FILE *out, FILE *log)
+{
+    if (nbMethodes == 1 || options->sequentiel)
+    {
+        for (int i = 0; i < nbMethodes; i++)
+            executerMethode(methodes[i], election, options, out, log);
+        return;
+    }
+
+    Tache taches[MAX_METHODES];
+    pthread_t threads[MAX_METHODES];
+    bool lance[MAX_METHODES];
+    for (int i = 0; i < nbMethodes; i++)
+    {
+        taches[i] = (Tache){methodes[i], election, options, NULL, 0, NULL, 0};
+        lance[i] = pthread_create(&threads[i], NULL, executerTache, &taches[i]) == 0;
+        // Sans thread disponible, la méthode est exécutée dans le thread courant
+        if (!lance[i])
+            executerTache(&taches[i]);
+    }
+
+    // Les tampons sont recopiés dans l'ordre de la liste, quel que soit l'ordre de fin des threads
+    for (int i = 0; i < nbMethodes; i++)
+    {
+        if (lance[i])
+            pthread_join(threads[i], NULL);
+        fwrite(taches[i].sortie, 1, taches[i].tailleSortie, out);
+        if (taches[i].journal != NULL)
+            fwrite(taches[i].journal, 1, taches[i].tailleJournal, log);
+        free(taches[i].sortie);
+        free(taches[i].journal);
+    }
+}
+
+/**
+ * @fn void libererElection(Election *election)
+ * @brief Libère les structures calculées par preparerElection, ainsi que la matrice des duels.
+ * @param[in, out] election Élection.
+ */
+void libererElection(Election *election)
+{
+    if (election->depouillement != NULL && election->depouillement != election->duels)
+        deleteDuelMatrix(election->depouillement);
+    // Le moteur incrémental possède la matrice des duels
+    if (election->incremental != NULL)
+        deleteIncrementalCondorcet(election->incremental);
+    else if (election->duels != NULL)
+        deleteDuelMatrix(election->duels);
+    if (election->histo != NULL)
+        deleteHistogramme(election->histo);
+    free(election->premieresPlaces);
+    election->depouillement = NULL;
+    election->duels = NULL;
+    election->histo = NULL;
+    election->premieresPlaces = NULL;
+    election->incremental = NULL;
+}
+
+/**
+ * @fn void fermerElection(Election *election)
+ * @brief Libère toute une élection chargée par chargerElection, structures dérivées comprises.
+ * @param[in, out] election Élection.
+ */
+void fermerElection(Election *election)
+{
+    libererElection(election);
+    if (election->duelNames != NULL)
+        freeDuelNames(election->duelNames, election->candidates->nb_candidates);
+    if (election->df != NULL)
+        freeDataFrame(election->df);
+    deleteCandidateTable(election->candidates);
+    *election = (Election){0};
+}
+
+#endif // EXECUTION_C
@@ -0,0 +1,173 @@
+/**
+ * @file execution.h
+ * @brief Préparation d'une élection et exécution concurrente des méthodes de vote.
+ * @author Bibyk Bogdan
+ * @date 18 octobre 2026
+ *
+ * Ce fichier d'en-tête définit l'exécution d'une liste de méthodes sur une même élection.
+ * Les structures partagées (dépouillement, matrice des duels, histogramme des positions) sont
+ * calculées une seule fois avant l'exécution, puis ne sont plus que lues : chaque méthode tourne
+ * dans son propre thread et écrit ses résultats et son log dans ses propres tampons, recopiés
+ * ensuite dans l'ordre de la liste.
+ *
+ */
+
+#ifndef EXECUTION_H
+#define EXECUTION_H
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include "lecture_csv.h"
+#include "candidats.h"
+#include "duels.h"
+#include "positionnel.h"
+#include "jugement_majoritaire.h"
+#include "condorcet_incremental.h"
+
+/**
+ * @def MAX_METHODES
+ * @brief Nombre maximal de méthodes exécutées sur une même élection.
+ */
+#define MAX_METHODES 32
+
+/**
+ * @struct OptionsScrutin
+ * @brief Options communes à toutes les méthodes.
+ */
+typedef struct OptionsScrutin
+{
+    bool debugMode; ///< Écriture des détails de chaque méthode dans le log.
+    bool earlyExit; ///< Dépouillement avec arrêt anticipé (uni1 et matrice des duels).
+    int nbSieges;   ///< Nombre de sièges du vote unique transférable.
+    const EchelleMentions *echelle; ///< Échelle de mentions du jugement majoritaire.
+    bool sequentiel;///< Exécution des méthodes l'une après l'autre, dans le thread appelant.
+} OptionsScrutin;
+
+/**
+ * @struct ResultatMethode
+ * @brief Résultat d'une méthode, tel qu'il est affiché.
+ */
+typedef struct ResultatMethode
+{
+    char *libelle;      ///< Libellé affiché (cm, cmv et cmo pour les variantes de Minimax).
+    int tour;           ///< Tour, ou rang de l'élu pour le vote unique transférable.
+    VoteResult resultat;///< Résultat.
+} ResultatMethode;
+
+/**
+ * @def nbResultatsMax(options)
+ * @brief Nombre maximal de résultats d'une méthode : trois pour uni2 et cm, un par siège pour stv.
+ */
+#define nbResultatsMax(options) ((options)->nbSieges > 3 ? (options)->nbSieges : 3)
+
+/**
+ * @struct Election
+ * @brief Données d'une élection partagées par les méthodes.
+ */
+typedef struct Election
+{
+    DataFrame *df;                ///< Bulletins, NULL si l'élection est chargée depuis une matrice de duels.
+    CandidateTable *candidates;   ///< Table des candidats.
+    DuelMatrix *duels;            ///< Matrice des duels, NULL si aucune méthode Condorcet n'est demandée.
+    DuelMatrix *depouillement;    ///< Dépouillement complet du scrutin à deux tours, peut être égal à duels.
+    int *premieresPlaces;         ///< Premières places de chaque candidat, calculées avec le dépouillement.
+    Histogramme *histo;           ///< Histogramme des positions, NULL si aucune méthode positionnelle n'est demandée.
+    char **duelNames;             ///< Noms des candidats lus dans une matrice de duels, NULL sinon.
+    IncrementalCondorcet *incremental; ///< Moteur des bulletins ajoutés un à un, propriétaire de duels, NULL sinon.
+} Election;
+
+/**
+ * @fn int listerMethodes(char *method, bool duel, char **methodes)
+ * @brief Découpe une liste de méthodes séparées par des virgules, "all" étant remplacé par toutes les méthodes disponibles.
+ * @param[in, out] method Liste des méthodes (modifiée par le découpage).
+ * @param[in] duel Indique si l'élection est chargée depuis une matrice de duels.
+ * @param[out] methodes Noms des méthodes, dans l'ordre d'affichage (MAX_METHODES cases).
+ * @return Nombre de méthodes.
+ */
+int listerMethodes(char *method, bool duel, char **methodes);
+
+/**
+ * @fn bool methodeValide(char *methode, bool duel)
+ * @brief Indique si une méthode est disponible.
+ * @param[in] methode Nom de la méthode.
+ * @param[in] duel Indique si l'élection est chargée depuis une matrice de duels.
+ * @return true si la méthode peut être exécutée.
+ */
+bool methodeValide(char *methode, bool duel);
+
+/**
+ * @fn bool chargerElection(Election *election, char *chemin, bool duel)
+ * @brief Charge une élection depuis un fichier de bulletins ou une matrice de duels.
+ * @param[out] election Élection, sans structure dérivée.
+ * @param[in] chemin Chemin du fichier.
+ * @param[in] duel Indique si le fichier est une matrice de duels.
+ * @return false si le fichier est illisible, mal formé ou sans candidat : l'élection est alors vide
+ *         et erreurLecture() décrit l'erreur.
+ */
+bool chargerElection(Election *election, char *chemin, bool duel);
+
+/**
+ * @fn void ajouterBulletinElection(Election *election, const int *rangs)
+ * @brief Ajoute un bulletin à une élection chargée, en ne mettant à jour que les méthodes Condorcet.
+ * @param[in, out] election Élection.
+ * @param[in] rangs Rang donné à chaque candidat (indexé par identifiant, -1 si non classé).
+ *
+ * @note Au premier ajout, la matrice des duels complète passe au moteur incrémental. Les autres
+ *       structures ne comptent pas les bulletins ajoutés : seules cm, cp et cs restent disponibles.
+ */
+void ajouterBulletinElection(Election *election, const int *rangs);
+
+/**
+ * @fn void preparerElection(Election *election, char **methodes, int nbMethodes, OptionsScrutin *options)
+ * @brief Calcule une seule fois les structures partagées nécessaires aux méthodes demandées.
+ * @param[in, out] election Élection, dont df (ou duels) et candidates sont déjà renseignés.
+ * @param[in] methodes Noms des méthodes.
+ * @param[in] nbMethodes Nombre de méthodes.
+ * @param[in] options Options du scrutin.
+ */
+void preparerElection(Election *election, char **methodes, int nbMethodes, OptionsScrutin *options);
+
+/**
+ * @fn int calculerMethode(char *methode, Election *election, OptionsScrutin *options, FILE *log, ResultatMethode *resultats)
+ * @brief Exécute une méthode et renvoie ses résultats dans l'ordre d'affichage.
+ * @param[in] methode Nom de la méthode.
+ * @param[in] election Élection préparée.
+ * @param[in] options Options du scrutin.
+ * @param[out] log Fichier de log.
+ * @param[out] resultats Résultats (nbResultatsMax(options) cases).
+ * @return Nombre de résultats.
+ */
+int calculerMethode(char *methode, Election *election, OptionsScrutin *options, FILE *log, ResultatMethode *resultats);
+
+/**
+ * @fn void executerMethodes(Election *election, char **methodes, int nbMethodes, OptionsScrutin *options, FILE *out, FILE *log)
+ * @brief Exécute les méthodes demandées, chacune dans son thread, et écrit leurs résultats dans l'ordre de la liste.
+ * @param[in] election Élection préparée.
+ * @param[in] methodes Noms des méthodes.
+ * @param[in] nbMethodes Nombre de méthodes.
+ * @param[in] options Options du scrutin.
+ * @param[out] out Fichier des résultats.
+ * @param[out] log Fichier de log, utilisé seulement en mode debug.
+ *
+ * @note Une méthode seule, ou toutes les méthodes en mode séquentiel, sont exécutées directement, sans thread ni tampon.
+ */
+void executerMethodes(Election *election, char **methodes, int nbMethodes, OptionsScrutin *options, FILE *out, FILE *log);
+
+/**
+ * @fn void libererElection(Election *election)
+ * @brief Libère les structures calculées par preparerElection, ainsi que la matrice des duels.
+ * @param[in, out] election Élection.
+ *
+ * @note Le DataFrame et la table des candidats restent à la charge de l'appelant.
+ */
+void libererElection(Election *election);
+
+/**
+ * @fn void fermerElection(Election *election)
+ * @brief Libère toute une élection chargée par chargerElection, structures dérivées comprises.
+ * @param[in, out] election Élection.
+ */
+void fermerElection(Election *election);
+
+#endif
@@ -0,0 +1,347 @@
+/**
+ * @file gen_ballots.c
+ * @brief Générateur d'élections synthétiques pour les tests de performance.
+ * @author Bibyk Bogdan
+ * @date 18 octobre 2026
+ *
+ * Ce programme écrit un fichier de bulletins au format lu par lecture_csv.c (colonnes Réponse,
+ * Soumis le :, Cours, Nom complet, puis une colonne Q00_Vote-> par candidat), ou directement la
+ * matrice des duels correspondante (option -d de scrutin).
+ *
+ * Les modèles de préférences (ic, mallows, polya) sont ceux de modeles.h, partagés avec l'option
+ * --simulate de scrutin.
+ *
+ * Chaque bulletin est tiré à partir de la graine et de son numéro seulement : le fichier produit ne
+ * dépend pas du nombre de threads. Pour l'urne de Pólya, la seule partie séquentielle est le choix
+ * du bulletin recopié, calculé avant la génération.
+ *
+ * @note lecture_csv.c lit des lignes d'au plus 1023 caractères : au-delà d'une trentaine de candidats,
+ *       l'en-tête est trop long et seule la matrice des duels (-d) est utilisable.
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "../modeles.h"
+
+/**
+ * @def VOTANTS_PAR_BLOC
+ * @brief Nombre de bulletins générés par un thread avant écriture.
+ */
+#define VOTANTS_PAR_BLOC 65536
+
+/**
+ * @def LIGNE_MAX_LECTURE
+ * @brief Longueur de ligne maximale acceptée par lecture_csv.c (MAXCHAR).
+ */
+#define LIGNE_MAX_LECTURE 1024
+
+/**
+ * @struct Bloc
+ * @brief Bulletins générés par un thread.
+ */
+typedef struct Bloc
+{
+    Generateur *gen;       ///< Générateur.
+    long long debut;       ///< Premier bulletin du bloc.
+    long long fin;         ///< Bulletin suivant le dernier du bloc.
+    char *texte;           ///< Lignes CSV du bloc (mode bulletins).
+    size_t taille;         ///< Taille des lignes.
+    long long *victoires;  ///< Matrice des duels du bloc (mode duels).
+} Bloc;
+
+//////////////////////
+// -- Génération -- //
+//////////////////////
+
+/**
+ * @fn static bool lisibleParScrutin(int nbCandidats)
+ * @brief Indique si l'en-tête et les lignes de bulletins tiennent dans la limite de lecture_csv.c.
+ * @param[in] nbCandidats Nombre de candidats.
+ * @return true si le fichier de bulletins peut être lu par scrutin.
+ */
+static bool lisibleParScrutin(int nbCandidats)
+{
+    // En-tête : colonnes fixes, puis ",Q00_Vote->N - Candidat N" par candidat
+    // Bulletin : numéro, date, cours et empreinte, puis ",rang" par candidat
+    long long entete = strlen("Réponse,Soumis le :,Cours,Nom complet");
+    long long ligne = 20 + 21 + 21 + 65;
+    for (int a = 1; a <= nbCandidats; a++)
+    {
+        int chiffres = snprintf(NULL, 0, "%d", a);
+        entete += 23 + 2 * chiffres;
+        ligne += 1 + snprintf(NULL, 0, "%d", nbCandidats);
+    }
+    return entete < LIGNE_MAX_LECTURE && ligne < LIGNE_MAX_LECTURE;
+}
+
+/**
+ * @fn static char *ecrireEntier(char *p, long long valeur, int chiffres)
+ * @brief Écrit un entier en décimal.
+ * @param[out] p Position d'écriture.
+ * @param[in] valeur Entier.
+ * @param[in] chiffres Nombre minimal de chiffres (complété par des zéros).
+ * @return Position suivant l'entier.
+ */
+static char *ecrireEntier(char *p, long long valeur, int chiffres)
+{
+    if (valeur < 0)
+    {
+        *p++ = '-';
+        valeur = -valeur;
+    }
+    char tampon[24];
+    int n = 0;
+    do
+    {
+        tampon[n++] = '0' + valeur % 10;
+        valeur /= 10;
+    } while (valeur > 0 || n < chiffres);
+    while (n > 0)
+        *p++ = tampon[--n];
+    return p;
+}
+
+/**
+ * @fn static void *genererBloc(void *arg)
+ * @brief Point d'entrée d'un thread : génère les bulletins d'un bloc.
+ * @param[in, out] arg Bloc à générer.
+ * @return NULL.
+ */
+static void *genererBloc(void *arg)
+{
+    static const char *cours = "Election synthetique";
+    static const char hexa[] = "0123456789abcdef";
+    Bloc *bloc = arg;
+    Generateur *gen = bloc->gen;
+    int c = gen->nbCandidats;
+    int ordre[c];
+    int rangs[c];
+
+    char *p = NULL;
+    if (bloc->victoires == NULL)
+        p = bloc->texte;
+    for (long long v = bloc->debut; v < bloc->fin; v++)
+    {
+        tirerClassement(gen, v, ordre, rangs);
+
+        if (bloc->victoires != NULL)
+        {
+            // Un candidat classé bat un candidat non classé : -1 devient la plus grande valeur non signée
+            for (int a = 0; a < c; a++)
+                for (int b = 0; b < c; b++)
+                    bloc->victoires[a * c + b] += (unsigned)rangs[a] < (unsigned)rangs[b];
+            continue;
+        }
+
+        // Réponse, Soumis le : (une seconde par bulletin), Cours, Nom complet (empreinte de 64 caractères)
+        long long seconde = v % 86400;
+        p = ecrireEntier(p, v + 1, 1);
+        memcpy(p, ",01/10/2026 ", 12);
+        p += 12;
+        p = ecrireEntier(p, seconde / 3600, 2);
+        *p++ = ':';
+        p = ecrireEntier(p, seconde / 60 % 60, 2);
+        *p++ = ':';
+        p = ecrireEntier(p, seconde % 60, 2);
+        *p++ = ',';
+        p = stpcpy(p, cours);
+        *p++ = ',';
+        uint64_t etat = fluxAleatoire(gen->graine, 4, v);
+        for (int k = 0; k < 4; k++)
+        {
+            uint64_t x = tirageSuivant(&etat);
+            for (int h = 0; h < 16; h++, x >>= 4)
+                *p++ = hexa[x & 15];
+        }
+        for (int a = 0; a < c; a++)
+        {
+            *p++ = ',';
+            p = ecrireEntier(p, rangs[a], 1);
+        }
+        *p++ = '\n';
+    }
+    if (bloc->victoires == NULL)
+        bloc->taille = p - bloc->texte;
+    return NULL;
+}
+
+/**
+ * @fn static void generer(Generateur *gen, int nbThreads, bool duels, FILE *out)
+ * @brief Génère tous les bulletins, par séries de nbThreads blocs écrites dans l'ordre.
+ * @param[in] gen Générateur.
+ * @param[in] nbThreads Nombre de threads.
+ * @param[in] duels Écriture de la matrice des duels plutôt que des bulletins.
+ * @param[out] out Fichier de sortie.
+ */
+static void generer(Generateur *gen, int nbThreads, bool duels, FILE *out)
+{
+    int c = gen->nbCandidats;
+    // Longueur maximale d'une ligne : numéro, date, cours, empreinte, puis un rang de 4 caractères par candidat
+    size_t ligneMax = 20 + 21 + 21 + 65 + (size_t)c * 5 + 1;
+    Bloc blocs[nbThreads];
+    pthread_t threads[nbThreads];
+    for (int t = 0; t < nbThreads; t++)
+    {
+        blocs[t] = (Bloc){gen, 0, 0, NULL, 0, NULL};
+        if (duels)
+            blocs[t].victoires = calloc((size_t)c * c, sizeof(long long));
+        else
+            blocs[t].texte = malloc(ligneMax * VOTANTS_PAR_BLOC);
+        if (blocs[t].victoires == NULL && blocs[t].texte == NULL)
+        {
+            perror("Erreur d'allocation mémoire");
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    if (duels)
+    {
+        fprintf(out, "Candidat 1");
+        for (int a = 1; a < c; a++)
+            fprintf(out, ",Candidat %d", a + 1);
+        fprintf(out, "\n");
+    }
+    else
+    {
+        fprintf(out, "Réponse,Soumis le :,Cours,Nom complet");
+        for (int a = 0; a < c; a++)
+            fprintf(out, ",Q00_Vote->%d - Candidat %d", a + 1, a + 1);
+        fprintf(out, "\n");
+    }
+
+    for (long long debut = 0; debut < gen->nbVotants; debut += (long long)nbThreads * VOTANTS_PAR_BLOC)
+    {
+        int lances = 0;
+        for (int t = 0; t < nbThreads; t++)
+        {
+            long long d = debut + (long long)t * VOTANTS_PAR_BLOC;
+            if (d >= gen->nbVotants)
+                break;
+            blocs[t].debut = d;
+            blocs[t].fin = d + VOTANTS_PAR_BLOC < gen->nbVotants ? d + VOTANTS_PAR_BLOC : gen->nbVotants;
+            if (pthread_create(&threads[t], NULL, genererBloc, &blocs[t]) != 0)
+            {
+                perror("pthread_create");
+                exit(EXIT_FAILURE);
+            }
+            lances++;
+        }
+        for (int t = 0; t < lances; t++)
+        {
+            pthread_join(threads[t], NULL);
+            if (!duels)
+                fwrite(blocs[t].texte, 1, blocs[t].taille, out);
+        }
+    }
+
+    if (duels)
+    {
+        // Les matrices des blocs sont additionnées
+        for (int t = 1; t < nbThreads; t++)
+            for (int k = 0; k < c * c; k++)
+                blocs[0].victoires[k] += blocs[t].victoires[k];
+        for (int a = 0; a < c; a++)
+        {
+            for (int b = 0; b < c; b++)
+                fprintf(out, b == 0 ? "%lld" : ",%lld", blocs[0].victoires[a * c + b]);
+            fprintf(out, "\n");
+        }
+    }
+
+    for (int t = 0; t < nbThreads; t++)
+    {
+        free(blocs[t].texte);
+        free(blocs[t].victoires);
+    }
+}
+
+////////////////
+// -- MAIN -- //
+////////////////
+
+/**
+ * @fn static void usage(void)
+ * @brief Affiche l'usage du programme et termine.
+ */
+static void usage(void)
+{
+    fprintf(stderr, "Usage: gen_ballots [-c candidats] [-v votants] [-m ic|mallows|polya] [-p phi|alpha] [-a abstention]\n");
+    fprintf(stderr, "                   [-g mentions] [-d] [-s graine] [-j threads] [-o fichier]\n");
+    exit(EXIT_FAILURE);
+}
+
+int main(int argc, char *argv[])
+{
+    Generateur gen = {IMPARTIAL, 5, 1000, -1, 0, 0, 1, NULL, NULL};
+    bool duels = false;
+    char *sortie = NULL;
+    int nbThreads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    if (nbThreads < 1)
+        nbThreads = 1;
+
+    int option;
+    while ((option = getopt(argc, argv, "c:v:m:p:a:g:ds:j:o:")) != -1)
+    {
+        switch (option)
+        {
+        case 'c':
+            gen.nbCandidats = atoi(optarg);
+            break;
+        case 'v':
+            gen.nbVotants = atoll(optarg);
+            break;
+        case 'm':
+            if (!lireModele(optarg, &gen.modele))
+                usage();
+            break;
+        case 'p':
+            gen.parametre = atof(optarg);
+            break;
+        case 'a':
+            gen.abstention = atof(optarg);
+            break;
+        case 'g':
+            gen.nbMentions = atoi(optarg);
+            break;
+        case 'd':
+            duels = true;
+            break;
+        case 's':
+            gen.graine = strtoull(optarg, NULL, 10);
+            break;
+        case 'j':
+            nbThreads = atoi(optarg);
+            break;
+        case 'o':
+            sortie = optarg;
+            break;
+        default:
+            usage();
+        }
+    }
+
+    if (nbThreads < 1 || !completerGenerateur(&gen))
+        usage();
+    if (!duels && !lisibleParScrutin(gen.nbCandidats))
+        fprintf(stderr, "Attention : les lignes dépassent %d caractères et ne seront pas lues par scrutin (utiliser -d)\n", LIGNE_MAX_LECTURE - 1);
+
+    preparerGenerateur(&gen);
+
+    FILE *out = sortie != NULL ? fopen(sortie, "w") : stdout;
+    if (out == NULL)
+    {
+        perror("fopen");
+        exit(EXIT_FAILURE);
+    }
+    generer(&gen, nbThreads, duels, out);
+    if (out != stdout)
+        fclose(out);
+
+    libererGenerateur(&gen);
+    return 0;
+}
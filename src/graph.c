@@ -4,7 +4,7 @@
  * @author Bibyk Bogdan
  * @date 07 décembre 2022
  * 
- * Ce fichier contient l'implémentation des fonctions pour l'utilisation des graphes statiques.
+ * Ce fichier contient l'implémentation des fonctions pour l'utilisation des graphes dynamiques.
  * Les graphes sont orientés et pondérés positivement.
  * 
 */
@@ -14,111 +14,165 @@
 
 #include "graph.h"
 
-Graph *createGraph(){
-    Graph *graph = malloc(sizeof(Graph));
-    graph->nb_nodes = 0;
-    return graph;
+#define WORD_BITS 64
+#define BIT_WORD(i) ((i) / WORD_BITS)
+#define BIT_MASK(i) ((uint64_t)1 << ((i) % WORD_BITS))
+
+static void *allocGraphMem(size_t size){
+    void *ptr = calloc(1, size);
+    if (ptr == NULL){
+        perror("Erreur d'allocation mémoire");
+        exit(EXIT_FAILURE);
     }
+    return ptr;
+}
 
-int addNode(Graph *graph, char *node){
-    if (graph->nb_nodes >= MAXNODES){
-        return -1;
+Graph *createGraph(int nb_nodes, char **names){
+    Graph *graph = allocGraphMem(sizeof(Graph));
+    graph->nb_nodes = nb_nodes;
+    graph->nb_active = nb_nodes;
+    graph->nb_words = (nb_nodes + WORD_BITS - 1) / WORD_BITS;
+    if (graph->nb_words == 0)
+        graph->nb_words = 1;
+    graph->matrix = allocGraphMem((size_t)nb_nodes * nb_nodes * sizeof(int) + sizeof(int));
+    graph->out = allocGraphMem((size_t)nb_nodes * graph->nb_words * sizeof(uint64_t) + sizeof(uint64_t));
+    graph->in = allocGraphMem((size_t)nb_nodes * graph->nb_words * sizeof(uint64_t) + sizeof(uint64_t));
+    graph->active = allocGraphMem(graph->nb_words * sizeof(uint64_t));
+    graph->names = allocGraphMem((size_t)nb_nodes * sizeof(char *) + sizeof(char *));
+    for (int i = 0; i < nb_nodes; i++){
+        graph->active[BIT_WORD(i)] |= BIT_MASK(i);
+        graph->names[i] = (names != NULL) ? names[i] : NULL;
     }
-    strcpy(graph->nodes[graph->nb_nodes], node);
-    return graph->nb_nodes++;
+    return graph;
 }
 
 int getNodeIndex(Graph *graph, char *node){
     for (int i = 0; i < graph->nb_nodes; i++){
-        if (strcmp(graph->nodes[i], node) == 0){
+        if (graph->names[i] != NULL && strcmp(graph->names[i], node) == 0){
             return i;
         }
     }
     return -1;
 }
 
-void setEdge(Graph *graph, char *from, char *to, int weight){
+int getEdge(Graph *graph, int from, int to){
+    return graph->matrix[from * graph->nb_nodes + to];
+}
+
+void setEdge(Graph *graph, int from, int to, int weight){
     if(weight>=0){
-        int i = getNodeIndex(graph, from);
-        int j = getNodeIndex(graph, to);
-        graph->matrix[i][j] = weight;
+        graph->matrix[from * graph->nb_nodes + to] = weight;
+        uint64_t *out = &graph->out[from * graph->nb_words + BIT_WORD(to)];
+        uint64_t *in = &graph->in[to * graph->nb_words + BIT_WORD(from)];
+        if (weight != 0){
+            *out |= BIT_MASK(to);
+            *in |= BIT_MASK(from);
+        } else {
+            *out &= ~BIT_MASK(to);
+            *in &= ~BIT_MASK(from);
+        }
+    }
+}
+
+// Affiche l'étiquette d'un noeud : sa lettre tant que l'alphabet suffit, son identifiant au-delà
+static void printNodeLabel(FILE *file, int node){
+    if (node < (int)strlen(ALPHABET)){
+        fprintf(file, " %c |", ALPHABET[node]);
+    } else {
+        fprintf(file, "%3d|", node);
     }
 }
 
 void printGraph(Graph *graph, FILE *file){
     fprintf(file, "   |");
     for (int i = 0; i < graph->nb_nodes; i++){
-        fprintf(file, " %c |", ALPHABET[i]);
+        if (isActive(graph, i)){
+            printNodeLabel(file, i);
+        }
     }
     fprintf(file, "     Légende :\n");
     for (int i = 0; i < graph->nb_nodes; i++){
-        fprintf(file, " %c |", ALPHABET[i]);
+        if (!isActive(graph, i)){
+            continue;
+        }
+        printNodeLabel(file, i);
         for (int j = 0; j < graph->nb_nodes; j++){
-            if(graph->matrix[i][j]==0){
+            if (!isActive(graph, j)){
+                continue;
+            }
+            if(getEdge(graph, i, j)==0){
                 fprintf(file, " - |");
             } else {
-                fprintf(file, "%3d|", graph->matrix[i][j]);
+                fprintf(file, "%3d|", getEdge(graph, i, j));
             }
         }
-        fprintf(file, "        %c : %s\n", ALPHABET[i], graph->nodes[i]);
+        fprintf(file, "        ");
+        printNodeLabel(file, i);
+        fprintf(file, " %s\n", graph->names[i] != NULL ? graph->names[i] : "");
     }
 }
 
-void removeEdge(Graph *graph, char *from, char *to){
-    int i = getNodeIndex(graph, from);
-    int j = getNodeIndex(graph, to);
-    graph->matrix[i][j] = 0;
+void removeEdge(Graph *graph, int from, int to){
+    setEdge(graph, from, to, 0);
+}
+
+bool isActive(Graph *graph, int node){
+    return (graph->active[BIT_WORD(node)] & BIT_MASK(node)) != 0;
 }
 
-bool isDominant(Graph *graph, char *node){
-    int p = getNodeIndex(graph, node);
-    for(int i = 0; i < graph->nb_nodes; i++){
-        if(graph->matrix[i][p] != 0){
+bool isDominant(Graph *graph, int node){
+    uint64_t *in = &graph->in[node * graph->nb_words];
+    for(int w = 0; w < graph->nb_words; w++){
+        if((in[w] & graph->active[w]) != 0){
             return false;
         }
     }
     return true;
 }
 
-bool isIsolated(Graph *graph, char *node){
-    int p = getNodeIndex(graph, node);
-    for(int j = 0; j < graph->nb_nodes; j++){
-        if(graph->matrix[p][j] != 0){
+bool isIsolated(Graph *graph, int node){
+    uint64_t *out = &graph->out[node * graph->nb_words];
+    for(int w = 0; w < graph->nb_words; w++){
+        if((out[w] & graph->active[w]) != 0){
             return false;
         }
     }
     return isDominant(graph, node);
 }
 
-int removeNode(Graph *graph, char *node){
-    int p = getNodeIndex(graph, node);
-    for (int j = p; j < graph->nb_nodes - 1; j++){
-        strcpy(graph->nodes[j], graph->nodes[j+1]);
+int removeNode(Graph *graph, int node){
+    if (!isActive(graph, node)){
+        return graph->nb_active;
     }
-    int i, j;
-    for (i = 0; i < graph->nb_nodes; i++){
-        for (j = p; j < graph->nb_nodes - 1; j++){
-            graph->matrix[i][j] = graph->matrix[i][j+1];
-        }
+    for (int i = 0; i < graph->nb_nodes; i++){
+        setEdge(graph, node, i, 0);
+        setEdge(graph, i, node, 0);
     }
-    for (j = 0; j < graph->nb_nodes; j++){
-        for (i = p; i < graph->nb_nodes - 1; i++){
-            graph->matrix[i][j] = graph->matrix[i+1][j];
+    graph->active[BIT_WORD(node)] &= ~BIT_MASK(node);
+    return --graph->nb_active;
+}
+
+int firstActiveNode(Graph *graph){
+    for (int i = 0; i < graph->nb_nodes; i++){
+        if (isActive(graph, i)){
+            return i;
         }
     }
-    return graph->nb_nodes--;
+    return -1;
 }
 
 void copyGraph(Graph *dest, Graph *src){
-    dest->nb_nodes = src->nb_nodes;
-    for (int i = 0; i < dest->nb_nodes; i++){
-        strcpy(dest->nodes[i], src->nodes[i]);
-    }
-    for (int i = 0; i < dest->nb_nodes; i++){
-        for (int j = 0; j < dest->nb_nodes; j++){
-            dest->matrix[i][j] = src->matrix[i][j];
-        }
+    if (dest->nb_nodes != src->nb_nodes){
+        fprintf(stderr, "copyGraph : les graphes n'ont pas le même nombre de noeuds\n");
+        exit(EXIT_FAILURE);
     }
+    size_t n = src->nb_nodes;
+    dest->nb_active = src->nb_active;
+    memcpy(dest->matrix, src->matrix, n * n * sizeof(int));
+    memcpy(dest->out, src->out, n * src->nb_words * sizeof(uint64_t));
+    memcpy(dest->in, src->in, n * src->nb_words * sizeof(uint64_t));
+    memcpy(dest->active, src->active, src->nb_words * sizeof(uint64_t));
+    memcpy(dest->names, src->names, n * sizeof(char *));
 }
 
 static bool isCycledUtil(Graph *graph, int v, bool visited[], bool *recStack) {
@@ -126,8 +180,12 @@ static bool isCycledUtil(Graph *graph, int v, bool visited[], bool *recStack) {
         visited[v] = true;
         recStack[v] = true;
 
-        for (int i = 0; i < graph->nb_nodes; i++) {
-            if (graph->matrix[v][i] != 0) {
+        uint64_t *out = &graph->out[v * graph->nb_words];
+        for (int w = 0; w < graph->nb_words; w++) {
+            uint64_t bits = out[w] & graph->active[w];
+            while (bits != 0) {
+                int i = w * WORD_BITS + __builtin_ctzll(bits);
+                bits &= bits - 1;
                 if (!visited[i] && isCycledUtil(graph, i, visited, recStack))
                     return true;
                 else if (recStack[i])
@@ -140,56 +198,75 @@ static bool isCycledUtil(Graph *graph, int v, bool visited[], bool *recStack) {
 }
 
 bool isCycled(Graph *graph) {
-    bool *visited = malloc(graph->nb_nodes * sizeof(bool));
-    bool *recStack = malloc(graph->nb_nodes * sizeof(bool));
-
-    for (int i = 0; i < graph->nb_nodes; i++) {
-        visited[i] = false;
-        recStack[i] = false;
-    }
+    bool *visited = calloc(graph->nb_nodes + 1, sizeof(bool));
+    bool *recStack = calloc(graph->nb_nodes + 1, sizeof(bool));
+    bool cycled = false;
 
-    for (int i = 0; i < graph->nb_nodes; i++) {
-        if (isCycledUtil(graph, i, visited, recStack))
-            return true;
+    for (int i = 0; i < graph->nb_nodes && !cycled; i++) {
+        if (isActive(graph, i) && isCycledUtil(graph, i, visited, recStack))
+            cycled = true;
     }
 
     free(visited);
     free(recStack);
-    return false;
-}
-
-static void swap(MatrixValue *a, MatrixValue *b)
-{
-    MatrixValue t = *a;
-    *a = *b;
-    *b = t;
+    return cycled;
 }
 
-static int partition(MatrixValue *arr, int low, int high)
-{
-    int pivot = arr[high].value;
-    int i = (low - 1);
-
-    for (int j = low; j <= high - 1; j++)
-    {
-        if (arr[j].value > pivot)
-        {
-            i++;
-            swap(&arr[i], &arr[j]);
+bool hasPath(Graph *graph, int from, int to) {
+    if (from == to)
+        return true;
+
+    int nb_words = graph->nb_words;
+    uint64_t *reached = calloc(nb_words, sizeof(uint64_t));
+    uint64_t *frontier = calloc(nb_words, sizeof(uint64_t));
+    reached[BIT_WORD(from)] |= BIT_MASK(from);
+    frontier[BIT_WORD(from)] |= BIT_MASK(from);
+    bool found = false;
+    bool pending = true;
+
+    // A chaque étape on retire un noeud de la frontière et on y ajoute ses successeurs non atteints
+    while (pending && !found) {
+        pending = false;
+        for (int w = 0; w < nb_words && !found; w++) {
+            while (frontier[w] != 0 && !found) {
+                int v = w * WORD_BITS + __builtin_ctzll(frontier[w]);
+                frontier[w] &= frontier[w] - 1;
+                uint64_t *out = &graph->out[v * nb_words];
+                for (int k = 0; k < nb_words; k++) {
+                    uint64_t next = out[k] & graph->active[k] & ~reached[k];
+                    reached[k] |= next;
+                    frontier[k] |= next;
+                    if (next != 0)
+                        pending = true;
+                }
+                found = (reached[BIT_WORD(to)] & BIT_MASK(to)) != 0;
+            }
         }
     }
-    swap(&arr[i + 1], &arr[high]);
-    return (i + 1);
+
+    free(reached);
+    free(frontier);
+    return found;
 }
 
-static void quickSort(MatrixValue *arr, int low, int high)
+/**
+ * @fn static int compareMatrixValues(const void *a, const void *b)
+ * @brief Ordre de tri des arêtes : poids décroissant, puis départ et arrivée croissants.
+ * @param[in] a Première arête.
+ * @param[in] b Seconde arête.
+ * @return Négatif si a doit être placée avant b, positif sinon.
+ *
+ * @note Départager les égalités par les identifiants rend l'ordre indépendant de l'algorithme de tri.
+ */
+static int compareMatrixValues(const void *a, const void *b)
 {
-    if (low < high)
-    {
-        int pi = partition(arr, low, high);
-        quickSort(arr, low, pi - 1);
-        quickSort(arr, pi + 1, high);
-    }
+    const MatrixValue *x = a;
+    const MatrixValue *y = b;
+    if (x->value != y->value)
+        return x->value > y->value ? -1 : 1;
+    if (x->row != y->row)
+        return x->row - y->row;
+    return x->col - y->col;
 }
 
 void sortedMatrixValues(Graph *graph, int **sortedValues, int **coordinates)
@@ -204,12 +281,12 @@ void sortedMatrixValues(Graph *graph, int **sortedValues, int **coordinates)
     {
         for (int j = 0; j < n; j++)
         {
-            arr[index] = (MatrixValue){graph->matrix[i][j], i, j};
+            arr[index] = (MatrixValue){getEdge(graph, i, j), i, j};
             index++;
         }
     }
 
-    quickSort(arr, 0, n * n - 1);
+    qsort(arr, n * n, sizeof(MatrixValue), compareMatrixValues);
 
     for (int i = 0; i < n * n; i++)
     {
@@ -253,6 +330,11 @@ void sortedMatrixValues(Graph *graph, int **sortedValues, int **coordinates)
 
 
 void deleteGraph(Graph *graph){
+    free(graph->matrix);
+    free(graph->out);
+    free(graph->in);
+    free(graph->active);
+    free(graph->names);
     free(graph);
 }
 
@@ -4,8 +4,10 @@
  * @author Bibyk Bogdan
  * @date 07 décembre 2022
  *
- * Ce fichier d'en-tete contient la structure des graphes statiques
+ * Ce fichier d'en-tete contient la structure des graphes dynamiques
  * et définit des fonctions pour les manipuler.
+ * Les noeuds sont identifiés par des entiers denses (0 à nb_nodes - 1),
+ * les noms ne servent qu'à l'affichage.
  *
  */
 
@@ -16,16 +18,28 @@
 #include <stdio.h>
 #include <string.h>
 #include <stdbool.h>
+#include <stdint.h>
 
 #define MAXCHAR 1024
-#define MAXNODES 10 // Eviter d'allet au-delà de 26 pour l'alphabet qui sert à l'affichage
 #define ALPHABET "ABCDEFGHIJKLMNOPQRSTUVWXYZ"
 
+/**
+ * @struct Graph
+ * @brief Graphe orienté pondéré, alloué dynamiquement.
+ * @details La matrice d'adjacence est stockée en ligne-majeure dans un seul bloc.
+ *          Une forme bitset (lignes et colonnes) est maintenue en parallèle pour
+ *          les tests de dominance et les parcours, ainsi que l'ensemble des noeuds actifs.
+ */
 typedef struct Graph
 {
-    int matrix[MAXNODES][MAXNODES];
-    char nodes[MAXNODES][MAXCHAR];
-    int nb_nodes;
+    int nb_nodes;      ///< Nombre total de noeuds (identifiants de 0 à nb_nodes - 1).
+    int nb_active;     ///< Nombre de noeuds non supprimés.
+    int nb_words;      ///< Nombre de mots de 64 bits par ligne de bitset.
+    int *matrix;       ///< Matrice d'adjacence nb_nodes x nb_nodes.
+    uint64_t *out;     ///< Bitset des successeurs : bit j de la ligne i à 1 si i -> j.
+    uint64_t *in;      ///< Bitset des prédécesseurs : bit i de la ligne j à 1 si i -> j.
+    uint64_t *active;  ///< Bitset des noeuds non supprimés.
+    char **names;      ///< Table des noms des noeuds (les chaînes ne sont pas copiées).
 } Graph;
 
 typedef struct
@@ -36,38 +50,44 @@ typedef struct
 } MatrixValue;
 
 /**
- * @fn Graph *createGraph()
- * @brief Fonction d'initialisation d'un graphe.
+ * @fn Graph *createGraph(int nb_nodes, char **names)
+ * @brief Fonction d'initialisation d'un graphe sans arêtes.
+ * @param[in] nb_nodes Nombre de noeuds du graphe.
+ * @param[in] names Table des noms des noeuds, indexée par identifiant (peut être NULL).
  * @return Structure représentat le graphe vide.
  */
-Graph *createGraph();
-
-/**
- * @fn int addNode(Graph *graph, char *node)
- * @brief Ajout d'un noe dans le graphe.
- * @param[in] graph Structure graph à modifier.
- * @param[in] node Nom du noeud à ajouter.
- * @return L'indice du nom du noeud.
- */
-int addNode(Graph *graph, char *node);
+Graph *createGraph(int nb_nodes, char **names);
 
 /**
  * @fn int getNodeIndex(Graph *graph, char *node)
- * @brief Retourne l'indice d'un noeud dans le graphe.
+ * @brief Retourne l'identifiant d'un noeud à partir de son nom.
  * @param[in] graph Structure graph.
  * @param[in] node Nom du noeud à trouver.
+ * @return L'identifiant du noeud, -1 s'il n'existe pas.
+ *
+ * @note Recherche linéaire, à réserver à l'analyse des entrées et jamais aux boucles de calcul.
  */
 int getNodeIndex(Graph *graph, char *node);
 
 /**
- * @fn void setEdge(Graph *graph, char *from, char *to, int weight)
+ * @fn int getEdge(Graph *graph, int from, int to)
+ * @brief Retourne le poids d'un lien entre deux noeuds.
+ * @param[in] graph Structure graph.
+ * @param[in] from Identifiant du noeud de depart.
+ * @param[in] to Identifiant du noeud d'arrivé.
+ * @return Poids du lien, 0 s'il n'existe pas.
+ */
+int getEdge(Graph *graph, int from, int to);
+
+/**
+ * @fn void setEdge(Graph *graph, int from, int to, int weight)
  * @brief Ajout d'un lien entre deux noeuds.
  * @param[in] graph Structure graph à modifier.
- * @param[in] from Nom du noeud de depart.
- * @param[in] to Nom du noeud d'arrivé.
- * @param[in] weight Poids du lien.
+ * @param[in] from Identifiant du noeud de depart.
+ * @param[in] to Identifiant du noeud d'arrivé.
+ * @param[in] weight Poids du lien (ignoré s'il est négatif, 0 supprime le lien).
  */
-void setEdge(Graph *graph, char *from, char *to, int weight);
+void setEdge(Graph *graph, int from, int to, int weight);
 
 /**
  * @fn void printGraph(Graph *graph, FILE *file)
@@ -78,51 +98,88 @@ void setEdge(Graph *graph, char *from, char *to, int weight);
 void printGraph(Graph *graph, FILE *file);
 
 /**
- * @fn void removeEdge(Graph *graph, char *from, char *to)
+ * @fn void removeEdge(Graph *graph, int from, int to)
  * @brief Suppression d'un lien entre deux noeuds.
  * @param[in] graph Structure graph à modifier.
- * @param[in] from Nom du noeud de depart.
- * @param[in] to Nom du noeud d'arrivé.
+ * @param[in] from Identifiant du noeud de depart.
+ * @param[in] to Identifiant du noeud d'arrivé.
+ */
+void removeEdge(Graph *graph, int from, int to);
+
+/**
+ * @fn bool isActive(Graph *graph, int node)
+ * @brief Indique si un noeud n'a pas été supprimé.
+ * @param[in] graph Structure graph.
+ * @param[in] node Identifiant du noeud à tester.
+ * @return Vrai si le noeud est toujours dans le graphe.
  */
-void removeEdge(Graph *graph, char *from, char *to);
+bool isActive(Graph *graph, int node);
 
 /**
- * @fn bool isDominant(Graph *graph, char *node)
- * @brief Indique si un noeud est dominant.
+ * @fn bool isDominant(Graph *graph, int node)
+ * @brief Indique si un noeud est dominant (aucun noeud actif ne pointe vers lui).
  * @param[in] graph Structure graph.
- * @param[in] node Nom du noeud à tester.
+ * @param[in] node Identifiant du noeud à tester.
  * @return Vrai si le noeud est dominant.
  */
-bool isDominant(Graph *graph, char *node);
+bool isDominant(Graph *graph, int node);
 
 /**
- * @fn bool isIsolated(Graph *graph, char *node)
+ * @fn bool isIsolated(Graph *graph, int node)
  * @brief Indique si un noeud est isole.
  * @param[in] graph Structure graph.
- * @param[in] node Nom du noeud à tester.
+ * @param[in] node Identifiant du noeud à tester.
  * @return Vrai si le noeud est isole.
  */
-bool isIsolated(Graph *graph, char *node);
+bool isIsolated(Graph *graph, int node);
 
 /**
- * @fn int removeNode(Graph *graph, char *node)
- * @brief Suppression d'un noeud.
+ * @fn int removeNode(Graph *graph, int node)
+ * @brief Suppression d'un noeud et de tous ses liens.
  * @param[in] graph Structure graph à modifier.
- * @param[in] node Nom du noeud à supprimer.
- * @return L'indice du noeud supprimé.
+ * @param[in] node Identifiant du noeud à supprimer.
+ * @return Le nombre de noeuds restants.
+ *
+ * @note Les identifiants des autres noeuds ne changent pas.
  */
-int removeNode(Graph *graph, char *node);
+int removeNode(Graph *graph, int node);
 
+/**
+ * @fn int firstActiveNode(Graph *graph)
+ * @brief Retourne le premier noeud non supprimé.
+ * @param[in] graph Structure graph.
+ * @return L'identifiant du noeud, -1 si le graphe est vide.
+ */
+int firstActiveNode(Graph *graph);
+
+/**
+ * @fn void copyGraph(Graph *dest, Graph *src)
+ * @brief Copie d'un graphe dans un autre de même taille.
+ * @param[out] dest Graphe de destination, créé avec le même nombre de noeuds.
+ * @param[in] src Graphe source.
+ */
 void copyGraph(Graph *dest, Graph *src);
 
 /**
- * @fn void deleteCycles(Graph *graph)
- * @brief Suppression des liens cycliques.
+ * @fn bool isCycled(Graph *graph)
+ * @brief Detection des cycles.
  * @param[in] graph Structure graph à vérifier.
  * @return Vrai si le graphe est cyclique.
  */
 bool isCycled(Graph *graph);
 
+/**
+ * @fn bool hasPath(Graph *graph, int from, int to)
+ * @brief Indique s'il existe un chemin entre deux noeuds actifs.
+ * @param[in] graph Structure graph.
+ * @param[in] from Identifiant du noeud de depart.
+ * @param[in] to Identifiant du noeud d'arrivé.
+ * @return Vrai si to est atteignable depuis from.
+ *
+ * @note Parcours en largeur sur la forme bitset, en O(nb_nodes² / 64).
+ */
+bool hasPath(Graph *graph, int from, int to);
+
 /**
  * @fn void deleteGraph(Graph *graph)
  * @brief Suppression du graphe.
@@ -136,7 +193,9 @@ void deleteGraph(Graph *graph);
  * @param[in] graph Structure graph à trier.
  * @param[out] sortedValues Tableau des valeurs triées.
  * @param[out] coordinates Tableau des coordonnées des valeurs triées.
+ *
+ * @note Les valeurs sont triées par ordre décroissant, les égalités par coordonnées croissantes.
  */
 void sortedMatrixValues(Graph *graph, int **sortedValues, int **coordinates);
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,216 @@
+/**
+ * @file journal.c
+ * @brief Niveaux du journal de débogage (option -o) et écriture asynchrone du fichier de log.
+ * @author Bibyk Bogdan
+ * @date 18 octobre 2026
+ *
+ * Ce fichier contient le flux asynchrone du journal. Le flux est créé avec fopencookie : stdio
+ * regroupe les petits messages dans son propre tampon, puis chaque vidage copie le bloc dans un
+ * tampon circulaire. Le thread écrivain recopie les blocs dans le fichier dans leur ordre d'arrivée.
+ *
+ */
+
+#ifndef JOURNAL_C
+#define JOURNAL_C
+
+#define _GNU_SOURCE
+#include <string.h>
+#include <strings.h>
+#include <pthread.h>
+#include "journal.h"
+
+/// Taille du tampon circulaire : au-delà, les méthodes attendent le thread écrivain.
+#define TAILLE_TAMPON_JOURNAL (1 << 20)
+
+NiveauJournal niveauJournal = JOURNAL_DETAILS;
+
+/**
+ * @struct JournalAsynchrone
+ * @brief Tampon circulaire partagé entre les threads qui journalisent et le thread écrivain.
+ */
+typedef struct JournalAsynchrone
+{
+    FILE *destination;       ///< Fichier de log.
+    char *tampon;            ///< Tampon circulaire.
+    size_t debut;            ///< Position du premier octet à écrire.
+    size_t taille;           ///< Nombre d'octets en attente.
+    bool fin;                ///< Demande d'arrêt, une fois le tampon vidé.
+    pthread_mutex_t verrou;  ///< Protège debut, taille et fin.
+    pthread_cond_t nonVide;  ///< Signalé lorsque des octets sont ajoutés ou que la fin est demandée.
+    pthread_cond_t nonPlein; ///< Signalé lorsque des octets ont été écrits.
+    pthread_t ecrivain;      ///< Thread écrivain.
+} JournalAsynchrone;
+
+/**
+ * @fn bool lireNiveauJournal(const char *nom, NiveauJournal *niveau)
+ * @brief Convertit un nom de niveau (resultats, details, trace) ou son numéro.
+ * @param[in] nom Nom du niveau.
+ * @param[out] niveau Niveau correspondant.
+ * @return false si le nom n'est pas reconnu.
+ */
+bool lireNiveauJournal(const char *nom, NiveauJournal *niveau)
+{
+    static const char *noms[] = {"resultats", "details", "trace"};
+    for (int n = JOURNAL_RESULTATS; n <= JOURNAL_TRACE; n++)
+    {
+        if (strcasecmp(nom, noms[n - 1]) == 0 || (nom[0] == '0' + n && nom[1] == '\0'))
+        {
+            *niveau = n;
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @fn static void *ecrireJournal(void *arg)
+ * @brief Thread écrivain : recopie le tampon dans le fichier jusqu'à la demande d'arrêt.
+ * @param[in, out] arg Journal.
+ * @return NULL.
+ */
+static void *ecrireJournal(void *arg)
+{
+    JournalAsynchrone *journal = arg;
+    pthread_mutex_lock(&journal->verrou);
+    while (true)
+    {
+        while (journal->taille == 0 && !journal->fin)
+            pthread_cond_wait(&journal->nonVide, &journal->verrou);
+        if (journal->taille == 0)
+            break;
+
+        // Le bloc contigu est écrit hors du verrou : les producteurs n'écrivent que dans la partie libre
+        size_t debut = journal->debut;
+        size_t n = journal->taille;
+        if (n > TAILLE_TAMPON_JOURNAL - debut)
+            n = TAILLE_TAMPON_JOURNAL - debut;
+        pthread_mutex_unlock(&journal->verrou);
+        fwrite(journal->tampon + debut, 1, n, journal->destination);
+        pthread_mutex_lock(&journal->verrou);
+
+        journal->debut = (debut + n) % TAILLE_TAMPON_JOURNAL;
+        journal->taille -= n;
+        pthread_cond_broadcast(&journal->nonPlein);
+    }
+    pthread_mutex_unlock(&journal->verrou);
+    fflush(journal->destination);
+    return NULL;
+}
+
+/**
+ * @fn static ssize_t ajouterJournal(void *cookie, const char *donnees, size_t taille)
+ * @brief Fonction d'écriture du flux : copie un bloc dans le tampon circulaire.
+ * @param[in, out] cookie Journal.
+ * @param[in] donnees Bloc vidé par stdio.
+ * @param[in] taille Taille du bloc.
+ * @return taille.
+ */
+static ssize_t ajouterJournal(void *cookie, const char *donnees, size_t taille)
+{
+    JournalAsynchrone *journal = cookie;
+    size_t copie = 0;
+    pthread_mutex_lock(&journal->verrou);
+    while (copie < taille)
+    {
+        while (journal->taille == TAILLE_TAMPON_JOURNAL)
+            pthread_cond_wait(&journal->nonPlein, &journal->verrou);
+
+        size_t fin = (journal->debut + journal->taille) % TAILLE_TAMPON_JOURNAL;
+        size_t n = taille - copie;
+        if (n > TAILLE_TAMPON_JOURNAL - journal->taille)
+            n = TAILLE_TAMPON_JOURNAL - journal->taille;
+        if (n > TAILLE_TAMPON_JOURNAL - fin)
+            n = TAILLE_TAMPON_JOURNAL - fin;
+        memcpy(journal->tampon + fin, donnees + copie, n);
+        journal->taille += n;
+        copie += n;
+        pthread_cond_signal(&journal->nonVide);
+    }
+    pthread_mutex_unlock(&journal->verrou);
+    return (ssize_t)taille;
+}
+
+/**
+ * @fn static void arreterEcrivain(JournalAsynchrone *journal)
+ * @brief Demande l'arrêt du thread écrivain et attend qu'il ait vidé le tampon.
+ * @param[in, out] journal Journal.
+ */
+static void arreterEcrivain(JournalAsynchrone *journal)
+{
+    pthread_mutex_lock(&journal->verrou);
+    journal->fin = true;
+    pthread_cond_signal(&journal->nonVide);
+    pthread_mutex_unlock(&journal->verrou);
+    pthread_join(journal->ecrivain, NULL);
+}
+
+/**
+ * @fn static void libererJournal(JournalAsynchrone *journal)
+ * @brief Libère le tampon et les primitives de synchronisation, sans fermer le fichier.
+ * @param[in, out] journal Journal.
+ */
+static void libererJournal(JournalAsynchrone *journal)
+{
+    pthread_cond_destroy(&journal->nonPlein);
+    pthread_cond_destroy(&journal->nonVide);
+    pthread_mutex_destroy(&journal->verrou);
+    free(journal->tampon);
+    free(journal);
+}
+
+/**
+ * @fn static int fermerJournal(void *cookie)
+ * @brief Fonction de fermeture du flux : attend l'écriture du tampon puis ferme le fichier.
+ * @param[in, out] cookie Journal.
+ * @return Résultat de la fermeture du fichier.
+ */
+static int fermerJournal(void *cookie)
+{
+    JournalAsynchrone *journal = cookie;
+    arreterEcrivain(journal);
+    int resultat = fclose(journal->destination);
+    libererJournal(journal);
+    return resultat;
+}
+
+/**
+ * @fn FILE *ouvrirJournalAsynchrone(FILE *destination)
+ * @brief Ouvre un flux dont le contenu est écrit dans destination par un thread dédié.
+ * @param[in] destination Fichier de log, fermé avec le flux renvoyé.
+ * @return Flux à fermer avec fclose, qui attend la fin des écritures ; destination elle-même en cas d'échec.
+ */
+FILE *ouvrirJournalAsynchrone(FILE *destination)
+{
+    JournalAsynchrone *journal = malloc(sizeof(JournalAsynchrone));
+    char *tampon = malloc(TAILLE_TAMPON_JOURNAL);
+    if (journal == NULL || tampon == NULL)
+    {
+        perror("malloc");
+        exit(EXIT_FAILURE);
+    }
+    *journal = (JournalAsynchrone){.destination = destination, .tampon = tampon};
+    pthread_mutex_init(&journal->verrou, NULL);
+    pthread_cond_init(&journal->nonVide, NULL);
+    pthread_cond_init(&journal->nonPlein, NULL);
+
+    // Sans thread écrivain, le journal est écrit directement
+    if (pthread_create(&journal->ecrivain, NULL, ecrireJournal, journal) != 0)
+    {
+        libererJournal(journal);
+        return destination;
+    }
+
+    cookie_io_functions_t fonctions = {.write = ajouterJournal, .close = fermerJournal};
+    FILE *flux = fopencookie(journal, "w", fonctions);
+    if (flux == NULL)
+    {
+        arreterEcrivain(journal);
+        libererJournal(journal);
+        return destination;
+    }
+    // Les blocs du tampon circulaire sont déjà groupés : un fflush du flux atteint le fichier sans attendre
+    setvbuf(destination, NULL, _IONBF, 0);
+    return flux;
+}
+
+#endif // JOURNAL_C
@@ -0,0 +1,77 @@
+/**
+ * @file journal.h
+ * @brief Niveaux du journal de débogage (option -o) et écriture asynchrone du fichier de log.
+ * @author Bibyk Bogdan
+ * @date 18 octobre 2026
+ *
+ * Ce fichier d'en-tête définit les niveaux du journal. Un message n'est écrit que si le mode debug
+ * est actif et si son niveau ne dépasse ni NIVEAU_JOURNAL_MAX, fixé à la compilation, ni le niveau
+ * choisi à l'exécution (option --log-level). Le test précède l'appel : les arguments d'un message
+ * filtré ne sont pas évalués, et -DNIVEAU_JOURNAL_MAX=0 supprime tout le journal du programme.
+ *
+ * Le fichier de log est écrit par un thread dédié : les méthodes remplissent un tampon circulaire
+ * et ne sont bloquées par les entrées-sorties que lorsqu'il est plein.
+ *
+ */
+
+#ifndef JOURNAL_H
+#define JOURNAL_H
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+
+/**
+ * @enum NiveauJournal
+ * @brief Niveaux de détail du journal, du moins au plus bavard.
+ */
+typedef enum NiveauJournal
+{
+    JOURNAL_RESULTATS = 1, ///< Vainqueur et résultats de chaque méthode.
+    JOURNAL_DETAILS = 2,   ///< Décomptes, classements et tours (niveau par défaut).
+    JOURNAL_TRACE = 3      ///< Chaque paire examinée et chaque arête verrouillée, avec le graphe.
+} NiveauJournal;
+
+#ifndef NIVEAU_JOURNAL_MAX
+/// Niveau maximal compilé : les messages plus bavards disparaissent du programme.
+#define NIVEAU_JOURNAL_MAX JOURNAL_TRACE
+#endif
+
+/// Niveau choisi à l'exécution, JOURNAL_DETAILS par défaut.
+extern NiveauJournal niveauJournal;
+
+/**
+ * @def journalActif(debugMode, niveau)
+ * @brief Indique si un message de ce niveau doit être écrit.
+ */
+#define journalActif(debugMode, niveau) ((niveau) <= NIVEAU_JOURNAL_MAX && (debugMode) && (niveau) <= niveauJournal)
+
+/**
+ * @def logprintf(log, debugMode, niveau, ...)
+ * @brief Écrit un message dans le journal si son niveau est actif, sans évaluer ses arguments sinon.
+ */
+#define logprintf(log, debugMode, niveau, ...)                   \
+    do                                                           \
+    {                                                            \
+        if (journalActif((debugMode), (niveau)))                 \
+            fprintf((log), __VA_ARGS__);                         \
+    } while (0)
+
+/**
+ * @fn bool lireNiveauJournal(const char *nom, NiveauJournal *niveau)
+ * @brief Convertit un nom de niveau (resultats, details, trace) ou son numéro.
+ * @param[in] nom Nom du niveau.
+ * @param[out] niveau Niveau correspondant.
+ * @return false si le nom n'est pas reconnu.
+ */
+bool lireNiveauJournal(const char *nom, NiveauJournal *niveau);
+
+/**
+ * @fn FILE *ouvrirJournalAsynchrone(FILE *destination)
+ * @brief Ouvre un flux dont le contenu est écrit dans destination par un thread dédié.
+ * @param[in] destination Fichier de log, fermé avec le flux renvoyé.
+ * @return Flux à fermer avec fclose, qui attend la fin des écritures ; destination elle-même en cas d'échec.
+ */
+FILE *ouvrirJournalAsynchrone(FILE *destination);
+
+#endif
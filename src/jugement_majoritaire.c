@@ -15,162 +15,278 @@
 
 // Structure pour stocker les Candidats, la liste avec les votes de chacune des mentions et leur mention majoritaire (Pour départage)
 typedef struct {
-    char *nom;
-    int votesMention[6];
+    int id;
+    int votesMention[MAX_MENTIONS];
     int mentionMajoritaire;
+    int partisans;  // Électeurs donnant une mention strictement meilleure que la mention majoritaire
+    int opposants;  // Électeurs donnant une mention strictement moins bonne que la mention majoritaire
 } Candidat;
 
 
-bool csvIsCondorcet(DataFrame *df) {
-    // Fonciton permettant de savoir si on doit convertir les notes des electeurs en mentions ou pas
-    for (int i = 4; i < df->num_columns; i++) {
-        for (int j = 0; j < df->num_rows; j++) {
-            int note = ((int *)df->columns[i].data)[j];
-            if (note > 6) {
-                return true;
-            }
+// Nombre de réponses distinctes comptées : 0 (ne se prononce pas), 1 à REPONSE_MAX, puis hors échelle
+#define NB_REPONSES (REPONSE_MAX + 2)
+
+// Échelles de mentions disponibles, avec la conversion des classements de 1 à 10 en mentions (-1 si l'électeur ne se prononce pas)
+static const EchelleMentions echelles[] = {
+    {5, {"Très bien", "Bien", "Assez bien", "Passable", "Insuffisant"},
+     {-1, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, -1}},
+    {6, {"Très bien", "Bien", "Assez bien", "Passable", "Médiocre", "À fuir"},
+     {-1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, -1}},
+    {7, {"Excellent", "Très bien", "Bien", "Assez bien", "Passable", "Insuffisant", "À rejeter"},
+     {-1, 1, 1, 2, 3, 3, 4, 5, 5, 6, 7, -1}},
+    {10, {"Excellent", "Très bien", "Bien", "Assez bien", "Passable", "Moyen", "Médiocre", "Insuffisant", "Mauvais", "À rejeter"},
+     {-1, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, -1}},
+};
+
+const EchelleMentions *echelleMentions(int nbMentions) {
+    for (size_t e = 0; e < sizeof(echelles) / sizeof(echelles[0]); e++) {
+        if (echelles[e].nb_mentions == nbMentions) {
+            return &echelles[e];
         }
     }
-    return false;
+    return NULL;
 }
 
-int convertirReponseEnNote(int reponse){
-    // Cette fonction permet de convertir les notes attribuées par les électeurs en mentions
-    if (reponse == 1) return 1; //TB
-    if (reponse >= 2 && reponse <= 3) return 2; //B
-    if (reponse >= 4 && reponse <= 5) return 3; //AB
-    if (reponse >= 6 && reponse <= 7) return 4; //P
-    if (reponse >= 8 && reponse <= 9) return 5; //M
-    if (reponse == 10) return 6;  //A fuir
-    return -1; //L'électeur ne se prononce pas;
+bool lireEchelleMentions(const char *description, EchelleMentions *echelle) {
+    // Noms des mentions séparés par des virgules, puis éventuellement ':' et la mention de chaque classement
+    const char *noms = description;
+    const char *deuxPoints = strchr(description, ':');
+    size_t longueurNoms = deuxPoints != NULL ? (size_t)(deuxPoints - description) : strlen(description);
+    EchelleMentions lue = {0};
+    while (noms < description + longueurNoms) {
+        size_t longueur = strcspn(noms, ",:");
+        if (longueur == 0 || longueur >= LONGUEUR_MENTION || lue.nb_mentions == MAX_MENTIONS) {
+            return false;
+        }
+        memcpy(lue.noms[lue.nb_mentions++], noms, longueur);
+        noms += longueur + (noms[longueur] == ',');
+    }
+    if (lue.nb_mentions < 2) {
+        return false;
+    }
+
+    // Sans table, les classements de 1 à REPONSE_MAX sont répartis également entre les mentions
+    lue.reponseEnMention[0] = -1;
+    lue.reponseEnMention[REPONSE_MAX + 1] = -1;
+    const char *conversion = deuxPoints != NULL ? deuxPoints + 1 : NULL;
+    for (int r = 1; r <= REPONSE_MAX; r++) {
+        if (conversion == NULL) {
+            lue.reponseEnMention[r] = 1 + (r - 1) * lue.nb_mentions / REPONSE_MAX;
+            continue;
+        }
+        char *fin;
+        long mention = strtol(conversion, &fin, 10);
+        if (fin == conversion || (mention != -1 && (mention < 1 || mention > lue.nb_mentions)) || *fin != (r < REPONSE_MAX ? ',' : '\0')) {
+            return false;
+        }
+        lue.reponseEnMention[r] = (int)mention;
+        conversion = fin + 1;
+    }
+    *echelle = lue;
+    return true;
 }
 
+// Fonction auxiliaire qui compte les réponses d'une colonne de notes, en un seul passage
+// Les réponses au-delà de nbCases - 2 tombent dans la dernière case. La case est choisie sans branchement
+// et quatre sous-histogrammes entrelacés évitent que deux incréments consécutifs de la même case dépendent
+// l'un de l'autre. Elle est toujours inlinée : avec un nombre de cases constant, l'histogramme tient
+// dans les registres et la fusion finale est déroulée
+static inline __attribute__((always_inline)) void compterCases(const int *notes, int nbLignes, int *reponses, int nbCases)
+{
+    int sous[4][NB_REPONSES] = {{0}};
+    int j = 0;
+    for (; j + 4 <= nbLignes; j += 4) {
+        for (int k = 0; k < 4; k++) {
+            int note = notes[j + k];
+            int indice = note > nbCases - 2 ? nbCases - 1 : note;
+            sous[k][indice < 0 ? 0 : indice]++;
+        }
+    }
+    for (; j < nbLignes; j++) {
+        int note = notes[j];
+        int indice = note > nbCases - 2 ? nbCases - 1 : note;
+        sous[0][indice < 0 ? 0 : indice]++;
+    }
+    for (int r = 0; r < NB_REPONSES; r++) {
+        reponses[r] = r < nbCases ? sous[0][r] + sous[1][r] + sous[2][r] + sous[3][r] : 0;
+    }
+}
+
+// Comptage de toutes les réponses, de 0 à REPONSE_MAX puis hors échelle, pour les classements à convertir
+static void compterReponses(const int *notes, int nbLignes, int *reponses)
+{
+    compterCases(notes, nbLignes, reponses, NB_REPONSES);
+}
+
+// Versions spécialisées pour les échelles courantes : les mentions de 1 à N, puis une case « hors échelle »
+#define DEFINIR_COMPTAGE(N) \
+    static void compterMentions##N(const int *notes, int nbLignes, int *reponses) { \
+        compterCases(notes, nbLignes, reponses, N + 2); \
+    }
+DEFINIR_COMPTAGE(5)
+DEFINIR_COMPTAGE(6)
+DEFINIR_COMPTAGE(7)
+
+// Fonction auxiliaire qui compte les mentions d'une colonne, la case nbMentions + 1 recevant les réponses hors échelle
+static void compterMentions(const int *notes, int nbLignes, int *reponses, int nbMentions)
+{
+    switch (nbMentions) {
+        case 5: compterMentions5(notes, nbLignes, reponses); break;
+        case 6: compterMentions6(notes, nbLignes, reponses); break;
+        case 7: compterMentions7(notes, nbLignes, reponses); break;
+        case REPONSE_MAX: compterReponses(notes, nbLignes, reponses); break;
+        default: compterCases(notes, nbLignes, reponses, nbMentions + 2); break;
+    }
+}
+
+// Fonction auxiliaire qui calcule les mentions d'un candidat à partir de l'histogramme de ses réponses
+static void noterCandidat(const int *reponses, const int *conversion, int nbMentions, int nbVotants, Candidat *candidat) {
+    // Mise à jour de la liste des mentions du Candidat
+    for (int m = 0; m < nbMentions; m++) {
+        candidat->votesMention[m] = 0;
+    }
+    for (int r = 1; r < NB_REPONSES; r++) {
+        int mention = conversion[r];
+        if (mention != -1) {
+            candidat->votesMention[mention - 1] += reponses[r];
+        }
+    }
+
+    // Recherche de la mention médiane par sommes cumulées
+    int cumul = 0;
+    candidat->mentionMajoritaire = nbMentions;
+    for (int m = 0; m < nbMentions - 1; m++) {
+        cumul += candidat->votesMention[m];
+        if (cumul > (nbVotants / 2)) {
+            candidat->mentionMajoritaire = m + 1;
+            break;
+        }
+    }
+
+    // Groupes de partisans et d'opposants, de part et d'autre de la mention majoritaire
+    candidat->partisans = 0;
+    candidat->opposants = 0;
+    for (int m = 0; m < nbMentions; m++) {
+        if (m < candidat->mentionMajoritaire - 1) {
+            candidat->partisans += candidat->votesMention[m];
+        } else if (m > candidat->mentionMajoritaire - 1) {
+            candidat->opposants += candidat->votesMention[m];
+        }
+    }
+}
 
-void MentionMajoritaireCandidats(Candidat *candidats, int nombreCandidats, DataFrame *df,bool isCondorcet) {
+void MentionMajoritaireCandidats(Candidat *candidats, int nombreCandidats, DataFrame *df, CandidateTable *candidates, const EchelleMentions *echelle) {
     // Cette fonction initialise les compteurs des mentions de chaque candidat et calcule leur mention majoritaire
+    // Les colonnes sont comptées à l'échelle des mentions ; dès qu'une réponse la dépasse, les notes sont des
+    // classements à convertir : les colonnes déjà vues sont recomptées sur toutes les réponses
+    int nbMentions = echelle->nb_mentions;
+    int (*reponses)[NB_REPONSES] = malloc((nombreCandidats + 1) * sizeof(*reponses));
+    if (reponses == NULL) {
+        perror("Erreur d'allocation mémoire");
+        exit(EXIT_FAILURE);
+    }
+    bool isCondorcet = false;
     for (int i = 0; i < nombreCandidats; i++) {
-        int compteurTB = 0, compteurB = 0, compteurAB = 0, compteurP = 0, compteurM = 0, compteurAFuir = 0;
-        for (int j = 0; j < df->num_rows; j++) {
-            int note;
-            if (isCondorcet){
-                // Convertir les notes en mentions
-                note = convertirReponseEnNote(((int *)df->columns[i + 4].data)[j]);
-            }
-            else{
-                note = ((int *)df->columns[i + 4].data)[j];
-            }
-            if (note == 1) {
-                compteurTB++;
-            } 
-            else if (note == 2) {
-                compteurB++;
-            } 
-            else if (note == 3) {
-                compteurAB++;
-            }
-            else if (note == 4) {
-                compteurP++;
-            } 
-            else if (note == 5) {
-                compteurM++;
-            } 
-            else if (note == 6) {
-                compteurAFuir++;
-            } 
-            else {
-                continue;
+        const int *notes = (int *)df->columns[candidates->columns[candidats[i].id]].data;
+        if (isCondorcet) {
+            compterReponses(notes, df->num_rows, reponses[i]);
+            continue;
+        }
+        compterMentions(notes, df->num_rows, reponses[i], nbMentions);
+        if (reponses[i][nbMentions + 1] > 0) {
+            isCondorcet = true;
+            for (int k = 0; k <= i; k++) {
+                compterReponses((int *)df->columns[candidates->columns[candidats[k].id]].data, df->num_rows, reponses[k]);
             }
         }
+    }
 
-        // Mise à jour de la liste des mentions du Candidat 
-        candidats[i].votesMention[0] = compteurTB;
-        candidats[i].votesMention[1] = compteurB;
-        candidats[i].votesMention[2] = compteurAB;
-        candidats[i].votesMention[3] = compteurP;
-        candidats[i].votesMention[4] = compteurM;
-        candidats[i].votesMention[5] = compteurAFuir;
-        
-        // Recherche par médiane du jugement majoritaire du candidat
-        if (compteurTB > (df->num_rows / 2)) {
-            candidats[i].mentionMajoritaire = 1;
-        } else if (compteurB + compteurTB > (df->num_rows / 2)) {
-            candidats[i].mentionMajoritaire = 2;
-        } else if (compteurAB + compteurB + compteurTB > (df->num_rows / 2)) {
-            candidats[i].mentionMajoritaire = 3;
-        } else if (compteurP + compteurAB + compteurB + compteurTB > (df->num_rows / 2)) {
-            candidats[i].mentionMajoritaire = 4;
-        } else if (compteurM + compteurP + compteurAB + compteurB + compteurTB > (df->num_rows / 2)) {
-            candidats[i].mentionMajoritaire = 5;
-        } else {
-            candidats[i].mentionMajoritaire = 6;
-        }
+    // Sans conversion, chaque note est directement une mention
+    int conversion[NB_REPONSES];
+    for (int r = 0; r < NB_REPONSES; r++) {
+        conversion[r] = isCondorcet ? echelle->reponseEnMention[r] : (r >= 1 && r <= nbMentions ? r : -1);
     }
+
+    for (int i = 0; i < nombreCandidats; i++) {
+        noterCandidat(reponses[i], conversion, nbMentions, df->num_rows, &candidats[i]);
+    }
+    free(reponses);
 }
 
 
 
-VoteResult voteJugementMajoritaire(DataFrame *df, FILE *log, bool debugMode){
-    // Fonction de calcul du gagnant par la méthode de jugement majoritaire
-    bool isCondorcet = csvIsCondorcet(df);
-    VoteResult result;
-    int nombreCandidats = df->num_columns - 4;
-    Candidat *candidats = (Candidat *)malloc(nombreCandidats * sizeof(Candidat));
-    char *columns_names[df->num_columns];
-    getColumnsNames(df, columns_names);
+// Fonction auxiliaire qui compare deux candidats selon leur jauge majoritaire
+// La jauge vaut (mention, +partisans) si les partisans sont plus nombreux que les opposants, (mention, -opposants) sinon :
+// une meilleure mention l'emporte, puis une jauge "+" sur une jauge "-", puis plus de partisans ou moins d'opposants
+// À jauge égale, le candidat de plus petit identifiant passe devant, ce qui rend l'ordre total
+static int comparerJauges(const void *a, const void *b) {
+    const Candidat *c1 = a;
+    const Candidat *c2 = b;
+    if (c1->mentionMajoritaire != c2->mentionMajoritaire) {
+        return c1->mentionMajoritaire < c2->mentionMajoritaire ? -1 : 1;
+    }
+    bool plus1 = c1->partisans > c1->opposants;
+    bool plus2 = c2->partisans > c2->opposants;
+    if (plus1 != plus2) {
+        return plus1 ? -1 : 1;
+    }
+    if (plus1 && c1->partisans != c2->partisans) {
+        return c1->partisans > c2->partisans ? -1 : 1;
+    }
+    if (!plus1 && c1->opposants != c2->opposants) {
+        return c1->opposants < c2->opposants ? -1 : 1;
+    }
+    return c1->id - c2->id;
+}
+
+// Fonction auxiliaire qui calcule les mentions et trie les candidats par jauge majoritaire, en O(C log C) après le décompte
+static Candidat *trierCandidats(DataFrame *df, CandidateTable *candidates, const EchelleMentions *echelle) {
+    int nombreCandidats = candidates->nb_candidates;
+    Candidat *candidats = (Candidat *)malloc((nombreCandidats + 1) * sizeof(Candidat));
+    if (candidats == NULL) {
+        perror("Erreur d'allocation mémoire");
+        exit(EXIT_FAILURE);
+    }
     for (int i = 0; i < nombreCandidats; i++) {
-        candidats[i].nom = columns_names[i + 4];
+        candidats[i].id = i;
     }
     // Calcul des mentions majoritaires de chaque candidat
-    MentionMajoritaireCandidats(candidats, nombreCandidats, df, isCondorcet);
-    int gagnantIndex = 0;
-    int mentionMax = candidats[gagnantIndex].mentionMajoritaire;
-    for (int i = 1; i < nombreCandidats; i++) {
-        if (candidats[i].mentionMajoritaire < mentionMax) {
-            // Nouvelle meilleure mentionMajoritaire
-            gagnantIndex = i;
-            mentionMax = candidats[gagnantIndex].mentionMajoritaire;
-        }
-        else if (candidats[i].mentionMajoritaire == mentionMax) {
-            // Départage des possibles gagnants en utilisant la méthode des groupes d'insatisfaits
-            int partisansGagnant1 = 0;
-            int opposantsGagnant1 = 0;
-            int partisansGagnant2 = 0;
-            int opposantsGagnant2 = 0;
-            for (int j = 0; j < 6; j++) {
-                if (j < mentionMax) {
-                    partisansGagnant1 += candidats[gagnantIndex].votesMention[j];
-                    partisansGagnant2 += candidats[i].votesMention[j];
-                }
-                else if (j>mentionMax) {
-                    opposantsGagnant1 += candidats[gagnantIndex].votesMention[j];
-                    opposantsGagnant2 += candidats[i].votesMention[j];
-                }
-            }
-            int poidsMax = max(max(partisansGagnant1,partisansGagnant2),max(opposantsGagnant1,opposantsGagnant2));
-            if (poidsMax==partisansGagnant2 || poidsMax == opposantsGagnant1){
-                // Si la valeur de poids maximum est le nombre d'opposants du gagnant actuel ou bien des partisans
-                // du deuxième candidat alors on modifie le gagnant.
-                gagnantIndex = i;
-                mentionMax = candidats[gagnantIndex].mentionMajoritaire;
-            };
-        }
+    MentionMajoritaireCandidats(candidats, nombreCandidats, df, candidates, echelle);
+    qsort(candidats, nombreCandidats, sizeof(Candidat), comparerJauges);
+    return candidats;
+}
+
+void classementJugementMajoritaire(DataFrame *df, CandidateTable *candidates, const EchelleMentions *echelle, int *classement) {
+    Candidat *candidats = trierCandidats(df, candidates, echelle);
+    for (int r = 0; r < candidates->nb_candidates; r++) {
+        classement[r] = candidats[r].id;
     }
+    free(candidats);
+}
+
+VoteResult voteJugementMajoritaire(DataFrame *df, CandidateTable *candidates, const EchelleMentions *echelle, FILE *log, bool debugMode){
+    // Fonction de calcul du gagnant par la méthode de jugement majoritaire : le premier du classement complet
+    Candidat *candidats = trierCandidats(df, candidates, echelle);
 
     // Remplir la structure de résultats
-    result.nb_candidates = nombreCandidats;
-    result.nb_voters = df->num_rows;
-    strcpy(result.winner, candidats[gagnantIndex].nom);
-    result.nb_candidates = nombreCandidats;
-    result.nb_voters = df->num_rows;
-    strcpy(result.winner, candidats[gagnantIndex].nom);
+    VoteResult result = createVoteResult(candidates, df->num_rows, 0, candidates->nb_candidates > 0 ? candidats[0].id : -1);
     // Ecriture des résultats du vote dans le fichier de log
-    if (debugMode) {
+    if (journalActif(debugMode, JOURNAL_RESULTATS)) {
         fprintf(log, "Résultats du vote par jugement majoritaire :\n");
-        fprintf(log, "Gagnant : %s\n", result.winner);
+        fprintf(log, "Gagnant : %s\n", candidateName(candidates, result.winner));
         fprintf(log, "Nombre de candidats : %d\n", result.nb_candidates);
         fprintf(log, "Nombre d'électeurs : %d\n", result.nb_voters);
+        fprintf(log, "Échelle : %d mentions\n", echelle->nb_mentions);
+        fprintf(log, "Classement :\n");
+        for (int r = 0; r < candidates->nb_candidates; r++) {
+            Candidat *c = &candidats[r];
+            bool plus = c->partisans > c->opposants;
+            fprintf(log, "\t%d. %s (mention %s%c, %s : %d)\n", r + 1, candidateName(candidates, c->id), echelle->noms[c->mentionMajoritaire - 1],
+                    plus ? '+' : '-', plus ? "partisans" : "opposants", plus ? c->partisans : c->opposants);
+        }
         fprintf(log, "\n");
     }
+    free(candidats);
     return result;
 }
 
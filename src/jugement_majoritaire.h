@@ -13,19 +13,92 @@
 
 #include "lecture_csv.h"
 #include "utils.h"
+#include "candidats.h"
 #include <stdio.h>
 #include <stdbool.h>
 #include <stdlib.h>
 #include <string.h>
 
 /**
- * @fn VoteResult voteJugementMajoritaire(DataFrame *df);
+ * @def MAX_MENTIONS
+ * @brief Nombre maximal de mentions d'une échelle.
+ */
+#define MAX_MENTIONS 10
+
+/**
+ * @def LONGUEUR_MENTION
+ * @brief Longueur maximale du nom d'une mention, caractère nul compris.
+ */
+#define LONGUEUR_MENTION 32
+
+/**
+ * @def REPONSE_MAX
+ * @brief Plus grand classement converti en mention, les réponses au-delà sont ignorées.
+ */
+#define REPONSE_MAX 10
+
+/**
+ * @struct EchelleMentions
+ * @brief Échelle de mentions du jugement majoritaire.
+ *
+ * Les électeurs donnent soit directement une mention (de 1, la meilleure, à nb_mentions), soit un
+ * classement de 1 à REPONSE_MAX. Dès qu'une réponse dépasse nb_mentions, toutes les réponses sont
+ * converties en mentions par la table reponseEnMention. Les échelles à 5, 6, 7 et 10 mentions sont
+ * prédéfinies ; une autre échelle peut être décrite sur la ligne de commande (voir lireEchelleMentions).
+ */
+typedef struct EchelleMentions
+{
+    int nb_mentions;                        ///< Nombre de mentions.
+    char noms[MAX_MENTIONS][LONGUEUR_MENTION]; ///< Nom de chaque mention, de la meilleure à la moins bonne.
+    int reponseEnMention[REPONSE_MAX + 2];  ///< Mention correspondant à chaque classement (-1 si l'électeur ne se prononce pas).
+} EchelleMentions;
+
+/**
+ * @fn const EchelleMentions *echelleMentions(int nbMentions)
+ * @brief Fonction de recherche d'une échelle de mentions par son nombre de mentions.
+ * @param[in] nbMentions Nombre de mentions (5, 6, 7 ou 10).
+ * @return Échelle correspondante, NULL si aucune échelle n'a ce nombre de mentions.
+ */
+const EchelleMentions *echelleMentions(int nbMentions);
+
+/**
+ * @fn bool lireEchelleMentions(const char *description, EchelleMentions *echelle)
+ * @brief Fonction de lecture d'une échelle de mentions décrite par l'utilisateur.
+ * @param[in] description Noms des mentions, de la meilleure à la moins bonne, séparés par des virgules, suivis
+ *            éventuellement de ':' et de la mention de chaque classement de 1 à REPONSE_MAX (-1 pour l'ignorer).
+ *            Exemple : "Pour,Plutôt pour,Plutôt contre,Contre:1,1,2,2,2,3,3,3,4,4".
+ * @param[out] echelle Échelle lue, inchangée en cas d'erreur.
+ * @return false si la description est invalide (moins de 2 ou plus de MAX_MENTIONS mentions, nom vide ou trop long,
+ *         table incomplète ou mention hors de l'échelle).
+ *
+ * @note Sans table, les classements sont répartis également entre les mentions.
+ */
+bool lireEchelleMentions(const char *description, EchelleMentions *echelle);
+
+/**
+ * @fn VoteResult voteJugementMajoritaire(DataFrame *df, CandidateTable *candidates, const EchelleMentions *echelle, FILE *log, bool debugMode);
  * @brief Fonction pour effectuer un vote selon la méthode de jugement majoritaire.
  * @param[in] df Pointeur vers le DataFrame contenant les résultats du vote.
+ * @param[in] candidates Table des candidats.
+ * @param[in] echelle Échelle de mentions.
  * @param[in] log Pointeur vers le fichier journal des sorties.
  * @param[in] debugMode Indique si le mode débogage est activé.
  * @return Structure VoteResult contenant les résultats du vote selon la méthode de jugement majoritaire.
  */
-VoteResult voteJugementMajoritaire(DataFrame *df, FILE *log, bool debugMode);
+VoteResult voteJugementMajoritaire(DataFrame *df, CandidateTable *candidates, const EchelleMentions *echelle, FILE *log, bool debugMode);
+
+/**
+ * @fn void classementJugementMajoritaire(DataFrame *df, CandidateTable *candidates, const EchelleMentions *echelle, int *classement)
+ * @brief Fonction pour obtenir le classement complet des candidats selon la méthode de jugement majoritaire.
+ * @param[in] df Pointeur vers le DataFrame contenant les résultats du vote.
+ * @param[in] candidates Table des candidats.
+ * @param[in] echelle Échelle de mentions.
+ * @param[out] classement Identifiants des candidats, du premier au dernier (nb_candidates cases).
+ *
+ * @note Les candidats sont triés par jauge majoritaire : mention majoritaire, puis le plus grand des deux groupes
+ *       (partisans, électeurs qui donnent une meilleure mention ; opposants, électeurs qui en donnent une moins bonne).
+ *       Le tri est en O(C log C) une fois les mentions comptées, et à jauge égale l'ordre des identifiants est conservé.
+ */
+void classementJugementMajoritaire(DataFrame *df, CandidateTable *candidates, const EchelleMentions *echelle, int *classement);
 
 #endif
\ No newline at end of file
@@ -8,7 +8,36 @@
  *
  */
 
+#include <errno.h>
+#include <stdarg.h>
 #include "lecture_csv.h"
+#include "statistiques.h"
+
+/// Message de la dernière erreur de lecture, propre à chaque thread.
+static _Thread_local char derniereErreur[MAXCHAR + 256];
+
+/**
+ * @fn void signalerErreurLecture(const char *format, ...)
+ * @brief Enregistre le message de la dernière erreur de lecture du thread appelant.
+ * @param[in] format Format du message, comme pour printf.
+ */
+void signalerErreurLecture(const char *format, ...)
+{
+    va_list arguments;
+    va_start(arguments, format);
+    vsnprintf(derniereErreur, sizeof(derniereErreur), format, arguments);
+    va_end(arguments);
+}
+
+/**
+ * @fn const char *erreurLecture(void)
+ * @brief Message de la dernière erreur de lecture du thread appelant.
+ * @return Message, valable jusqu'à la prochaine erreur de lecture du thread.
+ */
+const char *erreurLecture(void)
+{
+    return derniereErreur;
+}
 
 ////////////////////////////////////////////
 // -- Fonctions de gestion de fichiers -- //
@@ -18,18 +47,15 @@
  * @fn static FILE *openFile(char *path)
  * @brief Fonction d'ouverture d'un fichier en mode lecture seule
  * @param[in] path Chemin du fichier à ouvrir
- * @return Pointeur vers le fichier ouvert
+ * @return Pointeur vers le fichier ouvert, NULL si le fichier n'a pas pu être ouvert
  *
- * @note Cette fonction affiche un message d'erreur si le fichier n'a pas pu être ouvert.
+ * @note En cas d'échec, le message d'erreur est enregistré pour erreurLecture().
  */
 static FILE *openFile(char *path)
 {
     FILE *fp = fopen(path, "r");
     if (fp == NULL)
-    {
-        perror("fopen");
-        exit(EXIT_FAILURE);
-    }
+        signalerErreurLecture("%s : %s", path, strerror(errno));
     return fp;
 }
 
@@ -69,7 +95,8 @@ static char getDelimiter(FILE *fp)
 
     // On lit la première ligne du fichier
     char row[MAXCHAR];
-    fgets(row, MAXCHAR, fp);
+    if (fgets(row, MAXCHAR, fp) == NULL)
+        row[0] = '\0';
 
     // On parcourt la ligne pour trouver le délimiteur
     int i = 0;
@@ -103,7 +130,8 @@ static int getNumColumns(FILE *fp, char delimiter)
 
     // On lit la première ligne du fichier
     char row[MAXCHAR];
-    fgets(row, MAXCHAR, fp);
+    if (fgets(row, MAXCHAR, fp) == NULL)
+        row[0] = '\0';
 
     // On parcourt la ligne pour compter le nombre de délimiteurs
     int i = 0;
@@ -140,25 +168,32 @@ static int getNumRows(FILE *fp)
 }
 
 /**
- * @fn static void getRowElem(char row[MAXCHAR], char delimiter, char *data[])
+ * @fn static int getRowElem(char row[MAXCHAR], char delimiter, char *data[], int max_elems)
  * @brief Fonction de récupération des éléments d'une ligne d'un fichier CSV
  * @param[in] row Ligne du fichier à analyser
  * @param[in] delimiter Délimiteur du fichier
  * @param[out] data Tableau contenant les éléments de la ligne
+ * @param[in] max_elems Taille du tableau data
+ * @return Nombre d'éléments de la ligne, éventuellement supérieur à max_elems (seuls les max_elems premiers sont stockés)
  *
  * @details Cette fonction découpe une ligne de fichier CSV en fonction du délimiteur et stocke les éléments dans un tableau.
  */
-static void getRowElem(char row[MAXCHAR], char delimiter, char *data[])
+static int getRowElem(char row[MAXCHAR], char delimiter, char *data[], int max_elems)
 {
-    // La fonction strtok() découpe une chaîne de caractères en fonction d'un délimiteur
-    char *token = strtok(row, &delimiter);
+    // La fonction strtok_r() découpe une chaîne de caractères en fonction d'une chaîne de délimiteurs
+    // Contrairement à strtok(), elle garde sa position dans une variable locale : plusieurs fichiers peuvent être lus en parallèle
+    char delimiters[2] = {delimiter, '\0'};
+    char *position;
+    char *token = strtok_r(row, delimiters, &position);
     int i = 0;
     while (token != NULL)
     {
-        data[i] = token;
-        token = strtok(NULL, &delimiter); // On passe NULL pour continuer à découper la chaîne précédente
+        if (i < max_elems)
+            data[i] = token;
+        token = strtok_r(NULL, delimiters, &position); // On passe NULL pour continuer à découper la chaîne précédente
         i++;
     }
+    return i;
 }
 
 /**
@@ -242,7 +277,8 @@ static void strToTimestamp(char *data, time_t *timestamp)
 {
     char year[5], month[3], day[3], hour[3], minute[3], second[3];
     sscanf(data, "%2[^/]/%2[^/]/%4[^ ] %2[^:]:%2[^:]:%2s", day, month, year, hour, minute, second);
-    struct tm tm;
+    struct tm tm = {0};
+    tm.tm_isdst = -1;
     tm.tm_year = atoi(year) - 1900;
     tm.tm_mon = atoi(month) - 1;
     tm.tm_mday = atoi(day);
@@ -253,15 +289,16 @@ static void strToTimestamp(char *data, time_t *timestamp)
 }
 
 /**
- * @fn static char *timestampToStr(time_t timestamp)
+ * @fn static char *timestampToStr(time_t timestamp, char str[20])
  * @brief Fonction de conversion d'un timestamp en chaîne de caractères
- * @param[in] time_t Timestamp
- * @return char*
+ * @param[in] timestamp Timestamp
+ * @param[out] str Tampon de l'appelant, qui n'a rien à libérer
+ * @return str
  */
-static char *timestampToStr(time_t timestamp)
+static char *timestampToStr(time_t timestamp, char str[20])
 {
-    char *str = malloc(sizeof(char) * 20);
-    strftime(str, 20, "%d/%m/%Y %H:%M:%S", localtime(&timestamp));
+    struct tm tm;
+    strftime(str, 20, "%d/%m/%Y %H:%M:%S", localtime_r(&timestamp, &tm));
     return str;
 }
 
@@ -346,29 +383,37 @@ static void loadCsvMetadata(DataFrame *df, FILE *fp, char delimiter)
  */
 static void allocateColumnsMem(DataFrame *df)
 {
-    df->columns = (Column *)malloc(df->num_columns * sizeof(Column));
+    // Colonnes à zéro : un DataFrame abandonné en cours de lecture peut être libéré par freeDataFrame()
+    df->columns = (Column *)calloc(df->num_columns, sizeof(Column));
     if (df->columns == NULL)
         throwAllocationError();
 }
 
 /**
- * @fn static void nextRow(DataFrame *df, FILE *fp, char delimiter, char *row, char **data)
+ * @fn static char *nextRow(DataFrame *df, FILE *fp, char delimiter, char *row, char **data)
  * @brief Fonction de mise à jour d'une ligne d'un DataFrame
- * @param[in, out] df DataFrame
+ * @param[in] df DataFrame
  * @param[in] fp FILE
  * @param[in] delimiter char
  * @param[out] row char
  * @param[out] data char**
+ * @return Description de l'erreur, NULL si la ligne est valide
  *
  * @details Cette fonction permet de mettre à jour une ligne d'un DataFrame à partir d'un fichier CSV.
  *         La ligne est stockée dans un tableau de chaînes de caractères.
  *         Les données sont ensuites séparées et stockées dans un tableau de chaînes de caractères grâce à la fonction getRowElem().
  */
-static void nextRow(DataFrame *df, FILE *fp, char delimiter, char *row, char **data)
+static char *nextRow(DataFrame *df, FILE *fp, char delimiter, char *row, char **data)
 {
-    fgets(row, MAXCHAR, fp);
-    row[strcspn(row, "\n")] = '\0'; // Supprimer le \n
-    getRowElem(row, delimiter, data);
+    if (fgets(row, MAXCHAR, fp) == NULL)
+        return "ligne manquante";
+    size_t length = strcspn(row, "\n");
+    if (row[length] == '\0' && length == MAXCHAR - 1)
+        return "ligne trop longue";
+    row[length] = '\0'; // Supprimer le \n
+    if (getRowElem(row, delimiter, data, df->num_columns) != df->num_columns)
+        return "nombre de colonnes différent de l'en-tête";
+    return NULL;
 }
 
 /**
@@ -406,13 +451,11 @@ static void addColumnsName(DataFrame *df, char **data)
     {
         if (strstr(data[j], "Q01->") != NULL)
         {
-            char *sub_str = substr(data[j], 9, strlen(data[j]));
-            df->columns[j].name = strdup(sub_str);
+            df->columns[j].name = substr(data[j], 9, strlen(data[j]));
         }
         else if (strstr(data[j], "Q00_") != NULL)
         {
-            char *sub_str = substr(data[j], 14, strlen(data[j]));
-            df->columns[j].name = strdup(sub_str);
+            df->columns[j].name = substr(data[j], 14, strlen(data[j]));
         }
         else
         {
@@ -497,22 +540,51 @@ static void fillRow(DataFrame *df, char **data, int i)
     }
 }
 
+/**
+ * @fn static DataFrame *abandonDataFrame(DataFrame *df, FILE *fp, char *path, int line, char *message, int filled_rows)
+ * @brief Fonction d'abandon de la lecture d'un fichier CSV mal formé
+ * @param[in] df DataFrame en cours de remplissage, libéré
+ * @param[in] fp FILE, fermé
+ * @param[in] path Chemin du fichier
+ * @param[in] line Numéro de la ligne fautive
+ * @param[in] message Description de l'erreur
+ * @param[in] filled_rows Nombre de lignes de données déjà remplies
+ * @return NULL
+ */
+static DataFrame *abandonDataFrame(DataFrame *df, FILE *fp, char *path, int line, char *message, int filled_rows)
+{
+    signalerErreurLecture("%s, ligne %d : %s", path, line, message);
+    df->num_rows = filled_rows;
+    if (df->columns != NULL)
+        freeDataFrame(df);
+    else
+        free(df);
+    fclose(fp);
+    return NULL;
+}
+
 /**
  * @fn DataFrame *createDataFrameFromCsv(char *path)
  * @brief Fonction de création d'un DataFrame à partir d'un fichier CSV
  * @param[in] path char*
- * @return DataFrame*
+ * @return DataFrame*, NULL si le fichier est illisible ou mal formé (voir erreurLecture())
  */
 DataFrame *createDataFrameFromCsv(char *path)
 {
+    FILE *fp = openFile(path);
+    if (fp == NULL)
+        return NULL;
+
     // On commence par allouer la mémoire pour le DataFrame
     DataFrame *df;
     allocateDfMem(&df);
+    df->columns = NULL;
 
     // Ensuite on recupere le nombre de colonnes et de lignes
-    FILE *fp = openFile(path);
     char delimiter = getDelimiter(fp);
     loadCsvMetadata(df, fp, delimiter);
+    if (df->num_rows < 1)
+        return abandonDataFrame(df, fp, path, df->num_rows + 2, "aucune ligne de données", 0);
 
     // Ensuite on crée les colonnes
     allocateColumnsMem(df);
@@ -524,7 +596,9 @@ DataFrame *createDataFrameFromCsv(char *path)
     // Enfin on remplit le DataFrame ligne par ligne
     for (int i = 0; i <= df->num_rows; i++)
     {
-        nextRow(df, fp, delimiter, row, data);
+        char *error = nextRow(df, fp, delimiter, row, data);
+        if (error != NULL)
+            return abandonDataFrame(df, fp, path, i + 1, error, i > 1 ? i - 1 : 0);
         if (i == 0)
             addColumnsName(df, data);
         else
@@ -535,6 +609,8 @@ DataFrame *createDataFrameFromCsv(char *path)
         }
     }
 
+    STATS_AJOUTER(STAT_LIGNES, df->num_rows);
+    STATS_AJOUTER(STAT_OCTETS, ftell(fp));
     closeFile(fp);
     return df;
 }
@@ -561,6 +637,7 @@ void printDf(DataFrame *df)
     int *int_data;
     double *double_data;
     time_t *timestamp_data;
+    char date[20];
     char **string_data;
 
     // Afficher le contenu des colonnes
@@ -580,7 +657,7 @@ void printDf(DataFrame *df)
                 break;
             case TIMESTAMP:
                 timestamp_data = (time_t *)df->columns[col].data;
-                printf("%s\t", timestampToStr(timestamp_data[row]));
+                printf("%s\t", timestampToStr(timestamp_data[row], date));
                 break;
             case STRING:
                 string_data = (char **)df->columns[col].data;
@@ -763,6 +840,7 @@ Series getRow(DataFrame *df, char *column_name, char *value)
  */
 void printSeries(Series series)
 {
+    char date[20];
     printf("Serie de %d items\n", series.nb_items);
     for (int i = 0; i < series.nb_items; i++)
     {
@@ -777,7 +855,7 @@ void printSeries(Series series)
             printf("%lf\n", *item.value.double_value);
             break;
         case TIMESTAMP:
-            printf("%s\n", timestampToStr(*item.value.timestamp_value));
+            printf("%s\n", timestampToStr(*item.value.timestamp_value, date));
             break;
         case STRING:
             printf("%s\n", *item.value.string_value);
@@ -786,6 +864,16 @@ void printSeries(Series series)
     }
 }
 
+/**
+ * @fn void freeSeries(Series series)
+ * @brief Fonction de libération d'une Series (les valeurs restent dans le DataFrame)
+ * @param[in] series
+ */
+void freeSeries(Series series)
+{
+    free(series.items);
+}
+
 /**
  * @fn int selectIntFromSeries(Series series, char *label)
  * @brief Fonction de récupération d'une valeur INT d'une Series à partir de son label
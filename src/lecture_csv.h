@@ -30,10 +30,27 @@
  * @param[in] path Chemin du fichier à ouvrir.
  * @return Pointeur vers le fichier ouvert.
  *
- * Cette fonction ouvre un fichier en mode lecture seule. En cas d'échec, elle affiche un message d'erreur et termine le programme.
+ * Cette fonction ouvre un fichier en mode lecture seule. En cas d'échec, elle renvoie NULL et erreurLecture() décrit l'erreur.
  */
 static FILE *openFile(char *path);
 
+/**
+ * @fn void signalerErreurLecture(const char *format, ...)
+ * @brief Enregistre le message de la dernière erreur de lecture du thread appelant.
+ * @param[in] format Format du message, comme pour printf.
+ */
+void signalerErreurLecture(const char *format, ...);
+
+/**
+ * @fn const char *erreurLecture(void)
+ * @brief Message de la dernière erreur de lecture du thread appelant.
+ * @return Message, sans point final, valable jusqu'à la prochaine erreur de lecture du thread.
+ *
+ * Les fonctions de chargement (createDataFrameFromCsv, readDuelMatrixCsv) renvoient NULL en cas d'erreur
+ * au lieu de terminer le programme : l'appelant décide s'il s'arrête ou s'il passe au fichier suivant.
+ */
+const char *erreurLecture(void);
+
 ////////////////////////////////////////////////
 // -- Structures de données pour DataFrame -- //
 ////////////////////////////////////////////////
@@ -112,7 +129,9 @@ typedef struct
  * @param[in] path Chemin du fichier CSV.
  * @return Pointeur vers le DataFrame créé.
  *
- * Cette fonction crée un DataFrame à partir d'un fichier CSV situé au chemin spécifié. Elle alloue la mémoire nécessaire, lit les données depuis le fichier CSV et remplit le DataFrame. En cas d'erreur, elle renvoie NULL.
+ * Cette fonction crée un DataFrame à partir d'un fichier CSV situé au chemin spécifié. Elle alloue la mémoire nécessaire, lit les données depuis le fichier CSV et remplit le DataFrame.
+ * En cas d'erreur (fichier illisible, sans ligne de données, ligne trop longue ou dont le nombre de colonnes diffère de l'en-tête),
+ * elle ne garde rien d'alloué, renvoie NULL et erreurLecture() décrit l'erreur.
  */
 DataFrame *createDataFrameFromCsv(char *path);
 
@@ -195,6 +214,15 @@ Series getRow(DataFrame *df, char *column_name, char *value);
  */
 void printSeries(Series series);
 
+/**
+ * @fn void freeSeries(Series series)
+ * @brief Fonction de libération d'une Series renvoyée par getRow().
+ * @param[in] series Series à libérer.
+ *
+ * Seul le tableau d'items est libéré : les valeurs pointent dans le DataFrame, qui reste valide.
+ */
+void freeSeries(Series series);
+
 /**
  * @fn vint selectIntFromSeries(Series series, char *label)
  * @brief Fonction de sélection d'un item de type entier dans une Series.
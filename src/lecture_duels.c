@@ -0,0 +1,218 @@
+/**
+ * @file lecture_duels.c
+ * @brief Lecture directe d'une matrice de duels depuis un fichier CSV.
+ * @author Bibyk Bogdan
+ * @date 18 octobre 2026
+ *
+ * Fichier de chargement d'une matrice de duels. Chaque ligne est lue en entier puis
+ * découpée avec strtol, les valeurs sont écrites directement dans la matrice des duels.
+ *
+ */
+
+#ifndef LECTURE_DUELS_C
+#define LECTURE_DUELS_C
+
+#include "lecture_duels.h"
+#include "statistiques.h"
+#include <ctype.h>
+#include <errno.h>
+
+/**
+ * @fn static DuelMatrix *duelFileError(char *path, int line, char *message, FILE *fp, char *row, char ***names, int nb_candidates, DuelMatrix *duels)
+ * @brief Signale une erreur de format et libère la lecture en cours.
+ * @param[in] path Chemin du fichier.
+ * @param[in] line Numéro de la ligne fautive.
+ * @param[in] message Description de l'erreur.
+ * @param[in] fp Fichier lu, fermé par la fonction.
+ * @param[in] row Tampon de ligne, libéré par la fonction.
+ * @param[in, out] names Noms des candidats, libérés et remis à NULL s'ils ont été lus.
+ * @param[in] nb_candidates Nombre de noms lus.
+ * @param[in] duels Matrice en cours de remplissage, libérée si elle existe.
+ * @return NULL.
+ */
+static DuelMatrix *duelFileError(char *path, int line, char *message, FILE *fp, char *row, char ***names, int nb_candidates, DuelMatrix *duels)
+{
+    signalerErreurLecture("%s, ligne %d : %s", path, line, message);
+    free(row);
+    fclose(fp);
+    if (*names != NULL)
+        freeDuelNames(*names, nb_candidates);
+    *names = NULL;
+    if (duels != NULL)
+        deleteDuelMatrix(duels);
+    return NULL;
+}
+
+/**
+ * @fn static char findDelimiter(char *header)
+ * @brief Identification du délimiteur à partir de la ligne d'en-tête.
+ * @param[in] header Ligne d'en-tête.
+ * @return Délimiteur du fichier.
+ */
+static char findDelimiter(char *header)
+{
+    for (int i = 0; header[i] != '\0'; i++)
+    {
+        if (header[i] == ';' || header[i] == ',' || header[i] == '\t')
+            return header[i];
+    }
+    return ' ';
+}
+
+/**
+ * @fn static void trimEnd(char *str)
+ * @brief Supprime les fins de ligne et espaces en fin de chaîne.
+ * @param[in, out] str Chaîne à modifier.
+ */
+static void trimEnd(char *str)
+{
+    size_t len = strlen(str);
+    while (len > 0 && isspace((unsigned char)str[len - 1]))
+        str[--len] = '\0';
+}
+
+/**
+ * @fn static int splitHeader(char *header, char delimiter, char ***names)
+ * @brief Découpe la ligne d'en-tête en noms de candidats.
+ * @param[in] header Ligne d'en-tête, sans fin de ligne.
+ * @param[in] delimiter Délimiteur du fichier.
+ * @param[out] names Noms des candidats (copiés).
+ * @return Nombre de candidats.
+ */
+static int splitHeader(char *header, char delimiter, char ***names)
+{
+    int nb_candidates = 1;
+    for (int i = 0; header[i] != '\0'; i++)
+        nb_candidates += header[i] == delimiter;
+
+    *names = malloc((nb_candidates + 1) * sizeof(char *));
+    if (*names == NULL)
+    {
+        perror("Erreur d'allocation mémoire");
+        exit(EXIT_FAILURE);
+    }
+
+    char *start = header;
+    for (int c = 0; c < nb_candidates; c++)
+    {
+        char *end = strchr(start, delimiter);
+        size_t len = end == NULL ? strlen(start) : (size_t)(end - start);
+        (*names)[c] = strndup(start, len);
+        if ((*names)[c] == NULL)
+        {
+            perror("Erreur d'allocation mémoire");
+            exit(EXIT_FAILURE);
+        }
+        start += len + 1;
+    }
+    return nb_candidates;
+}
+
+/**
+ * @fn static char *parseRow(char *row, char delimiter, int *values, int nb_candidates)
+ * @brief Lit une ligne d'entiers de la matrice.
+ * @param[in] row Ligne à lire.
+ * @param[in] delimiter Délimiteur du fichier.
+ * @param[out] values Ligne de la matrice à remplir.
+ * @param[in] nb_candidates Nombre de valeurs attendues.
+ * @return Description de l'erreur, NULL si la ligne est valide.
+ */
+static char *parseRow(char *row, char delimiter, int *values, int nb_candidates)
+{
+    char *cursor = row;
+    for (int c = 0; c < nb_candidates; c++)
+    {
+        char *end;
+        long value = strtol(cursor, &end, 10);
+        if (end == cursor)
+            return "valeur entière attendue";
+        values[c] = (int)value;
+
+        while (isspace((unsigned char)*end) && *end != delimiter)
+            end++;
+        if (c < nb_candidates - 1)
+        {
+            if (*end != delimiter && delimiter != ' ')
+                return "nombre de colonnes insuffisant";
+            if (*end == delimiter)
+                end++;
+        }
+        else if (*end != '\0')
+            return "nombre de colonnes trop grand";
+        cursor = end;
+    }
+    return NULL;
+}
+
+/**
+ * @fn DuelMatrix *readDuelMatrixCsv(char *path, char ***names)
+ * @brief Fonction de chargement d'une matrice de duels depuis un fichier CSV.
+ * @param[in] path Chemin du fichier à lire.
+ * @param[out] names Noms des candidats, dans l'ordre des colonnes.
+ * @return Matrice des duels, NULL si le fichier est illisible ou mal formé (voir erreurLecture).
+ */
+DuelMatrix *readDuelMatrixCsv(char *path, char ***names)
+{
+    *names = NULL;
+    FILE *fp = fopen(path, "r");
+    if (fp == NULL)
+    {
+        signalerErreurLecture("%s : %s", path, strerror(errno));
+        return NULL;
+    }
+
+    char *row = NULL;
+    size_t size = 0;
+    if (getline(&row, &size, fp) == -1)
+        return duelFileError(path, 1, "fichier vide", fp, row, names, 0, NULL);
+    trimEnd(row);
+
+    char delimiter = findDelimiter(row);
+    int nb_candidates = splitHeader(row, delimiter, names);
+    DuelMatrix *duels = createDuelMatrix(nb_candidates);
+
+    // Chaque ligne i est écrite directement dans la ligne i de la matrice
+    int i = 0;
+    int line = 1;
+    while (getline(&row, &size, fp) != -1)
+    {
+        line++;
+        trimEnd(row);
+        if (row[0] == '\0')
+            continue;
+        if (i == nb_candidates)
+            return duelFileError(path, line, "la matrice a plus de lignes que de colonnes", fp, row, names, nb_candidates, duels);
+        char *erreur = parseRow(row, delimiter, &duels->wins[i * nb_candidates], nb_candidates);
+        if (erreur != NULL)
+            return duelFileError(path, line, erreur, fp, row, names, nb_candidates, duels);
+        DUEL_WINS(duels, i, i) = 0;
+        i++;
+    }
+    if (i != nb_candidates)
+        return duelFileError(path, line, "la matrice a moins de lignes que de colonnes", fp, row, names, nb_candidates, duels);
+    STATS_AJOUTER(STAT_LIGNES, nb_candidates);
+    STATS_AJOUTER(STAT_OCTETS, ftell(fp));
+    free(row);
+    fclose(fp);
+
+    for (int a = 0; a < nb_candidates; a++)
+        for (int b = a + 1; b < nb_candidates; b++)
+            duels->nb_ballots = max(duels->nb_ballots, DUEL_WINS(duels, a, b) + DUEL_WINS(duels, b, a));
+    duels->nb_read = duels->nb_ballots;
+    return duels;
+}
+
+/**
+ * @fn void freeDuelNames(char **names, int nb_candidates)
+ * @brief Fonction de libération des noms lus par readDuelMatrixCsv.
+ * @param[in] names Noms des candidats.
+ * @param[in] nb_candidates Nombre de candidats.
+ */
+void freeDuelNames(char **names, int nb_candidates)
+{
+    for (int c = 0; c < nb_candidates; c++)
+        free(names[c]);
+    free(names);
+}
+
+#endif // LECTURE_DUELS_C
@@ -0,0 +1,46 @@
+/**
+ * @file lecture_duels.h
+ * @brief Lecture directe d'une matrice de duels depuis un fichier CSV (en-tête).
+ * @author Bibyk Bogdan
+ * @date 18 octobre 2026
+ *
+ * Fichier d'en-tête pour le chargement d'une matrice de duels (option -d).
+ * Une matrice de duels est un carré d'entiers précédé d'une ligne de noms : elle est lue
+ * directement dans une matrice contiguë, sans passer par un DataFrame ni par la détection
+ * du type de chaque cellule.
+ *
+ */
+
+#ifndef LECTURE_DUELS_H
+#define LECTURE_DUELS_H
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include "duels.h"
+#include "lecture_csv.h"
+
+/**
+ * @fn DuelMatrix *readDuelMatrixCsv(char *path, char ***names)
+ * @brief Fonction de chargement d'une matrice de duels depuis un fichier CSV.
+ * @param[in] path Chemin du fichier à lire.
+ * @param[out] names Noms des candidats, dans l'ordre des colonnes.
+ * @return Matrice des duels, dont la case (i, j) est le nombre d'électeurs préférant i à j ;
+ *         NULL si le fichier ne peut pas être ouvert, si la matrice n'est pas carrée ou si une case n'est pas un entier.
+ *
+ * @details Le délimiteur (';', ',', tabulation ou espace) est déduit de la ligne d'en-tête.
+ *          Le nombre de bulletins est déduit du duel le plus disputé.
+ * @note En cas d'erreur, rien ne reste alloué, *names vaut NULL et erreurLecture() décrit l'erreur.
+ */
+DuelMatrix *readDuelMatrixCsv(char *path, char ***names);
+
+/**
+ * @fn void freeDuelNames(char **names, int nb_candidates)
+ * @brief Fonction de libération des noms lus par readDuelMatrixCsv.
+ * @param[in] names Noms des candidats.
+ * @param[in] nb_candidates Nombre de candidats.
+ */
+void freeDuelNames(char **names, int nb_candidates);
+
+#endif
@@ -0,0 +1,322 @@
+/**
+ * @file lot.c
+ * @brief Traitement par lot de nombreux fichiers de votes dans un seul processus.
+ * @author Bibyk Bogdan
+ * @date 18 octobre 2026
+ *
+ * Ce fichier contient l'implémentation du mode lot : lecture de la source, groupe de threads et
+ * affichage des résultats dans l'ordre de la source, fichier par fichier.
+ *
+ */
+
+#ifndef LOT_C
+#define LOT_C
+
+#include <string.h>
+#include <pthread.h>
+#include <glob.h>
+#include <unistd.h>
+#include "lot.h"
+
+/**
+ * @struct EntreeLot
+ * @brief Fichier à traiter et son résultat.
+ */
+typedef struct EntreeLot
+{
+    char *chemin;        ///< Chemin du fichier.
+    char *methodes;      ///< Méthodes demandées, séparées par des virgules.
+    bool duel;           ///< Indique si le fichier est une matrice de duels.
+    char *sortie;        ///< Résultats du fichier.
+    size_t tailleSortie; ///< Taille des résultats.
+    char *journal;       ///< Log du fichier.
+    size_t tailleJournal;///< Taille du log.
+    bool erreur;         ///< Indique si le fichier n'a pas pu être traité.
+    bool termine;        ///< Indique si les résultats sont prêts à être affichés.
+} EntreeLot;
+
+/**
+ * @struct Lot
+ * @brief État partagé par les threads du lot.
+ */
+typedef struct Lot
+{
+    EntreeLot *entrees;      ///< Fichiers à traiter.
+    int nbEntrees;           ///< Nombre de fichiers.
+    int suivant;             ///< Prochain fichier à commencer.
+    int affiches;            ///< Nombre de fichiers déjà affichés.
+    int fenetre;             ///< Nombre maximal de résultats en attente d'affichage.
+    OptionsScrutin *options; ///< Options du scrutin.
+    FILE *out;               ///< Fichier des résultats.
+    FILE *log;               ///< Fichier de log.
+    pthread_mutex_t verrou;  ///< Protège suivant, affiches et l'écriture des résultats.
+    pthread_cond_t place;    ///< Signalé quand un résultat est affiché.
+} Lot;
+
+/**
+ * @fn static void *allocLotMem(size_t size)
+ * @brief Fonction d'allocation mémoire initialisée à zéro, avec arrêt du programme en cas d'échec.
+ * @param[in] size Taille à allouer.
+ * @return Pointeur vers la mémoire allouée.
+ */
+static void *allocLotMem(size_t size)
+{
+    void *ptr = calloc(1, size);
+    if (ptr == NULL)
+    {
+        perror("Erreur d'allocation mémoire");
+        exit(EXIT_FAILURE);
+    }
+    return ptr;
+}
+
+/**
+ * @fn static void ajouterEntree(EntreeLot **entrees, int *nb, int *capacite, char *chemin, char *methodes, bool duel)
+ * @brief Ajoute un fichier à la liste du lot.
+ * @param[in, out] entrees Liste des fichiers.
+ * @param[in, out] nb Nombre de fichiers.
+ * @param[in, out] capacite Capacité allouée.
+ * @param[in] chemin Chemin du fichier (copié).
+ * @param[in] methodes Méthodes demandées (copiées).
+ * @param[in] duel Indique si le fichier est une matrice de duels.
+ */
+static void ajouterEntree(EntreeLot **entrees, int *nb, int *capacite, char *chemin, char *methodes, bool duel)
+{
+    if (*nb == *capacite)
+    {
+        *capacite = *capacite == 0 ? 64 : 2 * *capacite;
+        *entrees = realloc(*entrees, *capacite * sizeof(EntreeLot));
+        if (*entrees == NULL)
+        {
+            perror("Erreur d'allocation mémoire");
+            exit(EXIT_FAILURE);
+        }
+    }
+    (*entrees)[*nb] = (EntreeLot){strdup(chemin), strdup(methodes), duel, NULL, 0, NULL, 0, false, false};
+    (*nb)++;
+}
+
+/**
+ * @fn static EntreeLot *lireSource(char *source, char *methodesParDefaut, int *nb)
+ * @brief Construit la liste des fichiers à partir d'un motif ou d'un manifeste.
+ * @param[in] source Motif ou chemin du manifeste.
+ * @param[in] methodesParDefaut Méthodes des fichiers qui n'en précisent pas.
+ * @param[out] nb Nombre de fichiers.
+ * @return Liste des fichiers.
+ */
+static EntreeLot *lireSource(char *source, char *methodesParDefaut, int *nb)
+{
+    EntreeLot *entrees = NULL;
+    int capacite = 0;
+    *nb = 0;
+
+    if (strpbrk(source, "*?[") != NULL)
+    {
+        glob_t fichiers;
+        if (glob(source, 0, NULL, &fichiers) == 0)
+        {
+            for (size_t i = 0; i < fichiers.gl_pathc; i++)
+                ajouterEntree(&entrees, nb, &capacite, fichiers.gl_pathv[i], methodesParDefaut, false);
+        }
+        globfree(&fichiers);
+        return entrees;
+    }
+
+    FILE *fp = fopen(source, "r");
+    if (fp == NULL)
+    {
+        perror("fopen");
+        exit(EXIT_FAILURE);
+    }
+    char *ligne = NULL;
+    size_t taille = 0;
+    while (getline(&ligne, &taille, fp) != -1)
+    {
+        char *position;
+        char *mot = strtok_r(ligne, " \t\r\n", &position);
+        if (mot == NULL || mot[0] == '#')
+            continue;
+        bool duel = strcmp(mot, "-d") == 0;
+        char *chemin = duel ? strtok_r(NULL, " \t\r\n", &position) : mot;
+        if (chemin == NULL)
+            continue;
+        char *methodes = strtok_r(NULL, " \t\r\n", &position);
+        ajouterEntree(&entrees, nb, &capacite, chemin, methodes != NULL ? methodes : methodesParDefaut, duel);
+    }
+    free(ligne);
+    fclose(fp);
+    return entrees;
+}
+
+/**
+ * @fn static void traiterEntree(EntreeLot *entree, OptionsScrutin *options, FILE *out, FILE *log)
+ * @brief Charge un fichier, exécute ses méthodes et libère ses données.
+ * @param[in, out] entree Fichier à traiter.
+ * @param[in] options Options du scrutin.
+ * @param[out] out Résultats du fichier.
+ * @param[out] log Log du fichier.
+ */
+static void traiterEntree(EntreeLot *entree, OptionsScrutin *options, FILE *out, FILE *log)
+{
+    if (access(entree->chemin, R_OK) != 0)
+    {
+        fprintf(out, "erreur : fichier illisible\n");
+        entree->erreur = true;
+        return;
+    }
+
+    char methode[strlen(entree->methodes) + 1];
+    strcpy(methode, entree->methodes);
+    char *methodes[MAX_METHODES];
+    int nbMethodes = listerMethodes(methode, entree->duel, methodes);
+    for (int i = 0; i < nbMethodes; i++)
+    {
+        if (!methodeValide(methodes[i], entree->duel))
+        {
+            fprintf(out, "erreur : méthode inconnue %s\n", methodes[i]);
+            entree->erreur = true;
+            return;
+        }
+    }
+
+    // Un fichier mal formé est signalé dans ses résultats, les autres fichiers du lot continuent
+    Election election;
+    if (!chargerElection(&election, entree->chemin, entree->duel))
+    {
+        fprintf(out, "erreur : %s\n", erreurLecture());
+        entree->erreur = true;
+        return;
+    }
+    preparerElection(&election, methodes, nbMethodes, options);
+    executerMethodes(&election, methodes, nbMethodes, options, out, log);
+    fermerElection(&election);
+}
+
+/**
+ * @fn static void afficherEntree(EntreeLot *entree, FILE *out, FILE *log)
+ * @brief Écrit les résultats d'un fichier, chaque ligne préfixée par son chemin, puis les libère.
+ * @param[in, out] entree Fichier traité.
+ * @param[out] out Fichier des résultats.
+ * @param[out] log Fichier de log.
+ */
+static void afficherEntree(EntreeLot *entree, FILE *out, FILE *log)
+{
+    char *ligne = entree->sortie;
+    char *fin = entree->sortie + entree->tailleSortie;
+    while (ligne < fin)
+    {
+        char *retour = memchr(ligne, '\n', fin - ligne);
+        size_t longueur = retour != NULL ? (size_t)(retour - ligne) : (size_t)(fin - ligne);
+        fprintf(out, "%s: %.*s\n", entree->chemin, (int)longueur, ligne);
+        ligne += longueur + 1;
+    }
+    if (entree->journal != NULL && entree->tailleJournal > 0)
+    {
+        fprintf(log, "=== %s ===\n", entree->chemin);
+        fwrite(entree->journal, 1, entree->tailleJournal, log);
+    }
+    free(entree->sortie);
+    free(entree->journal);
+    entree->sortie = NULL;
+    entree->journal = NULL;
+}
+
+/**
+ * @fn static void *travailleur(void *arg)
+ * @brief Boucle d'un thread du lot : prend le prochain fichier, le traite et affiche les résultats prêts.
+ * @param[in, out] arg État du lot.
+ * @return NULL.
+ */
+static void *travailleur(void *arg)
+{
+    Lot *lot = arg;
+    pthread_mutex_lock(&lot->verrou);
+    while (true)
+    {
+        // Un fichier n'est commencé que s'il reste de la place dans la fenêtre d'affichage
+        while (lot->suivant < lot->nbEntrees && lot->suivant >= lot->affiches + lot->fenetre)
+            pthread_cond_wait(&lot->place, &lot->verrou);
+        if (lot->suivant >= lot->nbEntrees)
+            break;
+        EntreeLot *entree = &lot->entrees[lot->suivant++];
+        pthread_mutex_unlock(&lot->verrou);
+
+        FILE *out = open_memstream(&entree->sortie, &entree->tailleSortie);
+        FILE *log = lot->options->debugMode ? open_memstream(&entree->journal, &entree->tailleJournal) : NULL;
+        if (out == NULL || (lot->options->debugMode && log == NULL))
+        {
+            perror("open_memstream");
+            exit(EXIT_FAILURE);
+        }
+        traiterEntree(entree, lot->options, out, log);
+        fclose(out);
+        if (log != NULL)
+            fclose(log);
+
+        // Les résultats sont affichés dans l'ordre de la source, dès que tous les précédents le sont
+        pthread_mutex_lock(&lot->verrou);
+        entree->termine = true;
+        while (lot->affiches < lot->nbEntrees && lot->entrees[lot->affiches].termine)
+            afficherEntree(&lot->entrees[lot->affiches++], lot->out, lot->log);
+        pthread_cond_broadcast(&lot->place);
+    }
+    pthread_mutex_unlock(&lot->verrou);
+    return NULL;
+}
+
+/**
+ * @fn int traiterLot(char *source, char *methodesParDefaut, OptionsScrutin *options, int nbThreads, FILE *out, FILE *log)
+ * @brief Traite tous les fichiers d'un manifeste ou d'un motif.
+ * @param[in] source Chemin du manifeste, ou motif de fichiers s'il contient '*', '?' ou '['.
+ * @param[in] methodesParDefaut Méthodes des fichiers qui n'en précisent pas.
+ * @param[in] options Options du scrutin.
+ * @param[in] nbThreads Nombre de fichiers traités en parallèle.
+ * @param[out] out Fichier des résultats.
+ * @param[out] log Fichier de log, utilisé seulement en mode debug.
+ * @return Nombre de fichiers en erreur.
+ */
+int traiterLot(char *source, char *methodesParDefaut, OptionsScrutin *options, int nbThreads, FILE *out, FILE *log)
+{
+    Lot lot = {0};
+    lot.entrees = lireSource(source, methodesParDefaut, &lot.nbEntrees);
+    lot.fenetre = 4 * nbThreads;
+    lot.out = out;
+    lot.log = log;
+
+    // Les méthodes d'un même fichier s'exécutent à la suite : le parallélisme se fait entre fichiers
+    OptionsScrutin optionsLot = *options;
+    optionsLot.sequentiel = true;
+    lot.options = &optionsLot;
+    pthread_mutex_init(&lot.verrou, NULL);
+    pthread_cond_init(&lot.place, NULL);
+
+    if (nbThreads > lot.nbEntrees)
+        nbThreads = lot.nbEntrees;
+    pthread_t *threads = allocLotMem((nbThreads + 1) * sizeof(pthread_t));
+    int nbLances = 0;
+    for (int i = 0; i < nbThreads; i++)
+    {
+        if (pthread_create(&threads[nbLances], NULL, travailleur, &lot) == 0)
+            nbLances++;
+    }
+    // Sans thread disponible, le lot est traité dans le thread courant
+    if (nbLances == 0)
+        travailleur(&lot);
+    for (int i = 0; i < nbLances; i++)
+        pthread_join(threads[i], NULL);
+
+    int nbErreurs = 0;
+    for (int i = 0; i < lot.nbEntrees; i++)
+    {
+        nbErreurs += lot.entrees[i].erreur;
+        free(lot.entrees[i].chemin);
+        free(lot.entrees[i].methodes);
+    }
+    free(lot.entrees);
+    free(threads);
+    pthread_mutex_destroy(&lot.verrou);
+    pthread_cond_destroy(&lot.place);
+    return nbErreurs;
+}
+
+#endif // LOT_C
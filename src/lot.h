@@ -0,0 +1,41 @@
+/**
+ * @file lot.h
+ * @brief Traitement par lot de nombreux fichiers de votes dans un seul processus.
+ * @author Bibyk Bogdan
+ * @date 18 octobre 2026
+ *
+ * Ce fichier d'en-tête définit le mode lot. La source est :
+ * - soit un motif de fichiers (par exemple "data/groupe_*.csv"), chaque fichier recevant les méthodes de -m ;
+ * - soit un manifeste, une entrée par ligne : "[-d] chemin [méthode,méthode...]".
+ *   Les lignes vides et celles commençant par '#' sont ignorées, -d indique une matrice de duels
+ *   et, sans méthode, celles de -m sont utilisées.
+ * Les fichiers sont traités par un groupe de threads. Chaque ligne de résultat est préfixée par le
+ * chemin du fichier, et les fichiers sont affichés dans l'ordre de la source.
+ *
+ */
+
+#ifndef LOT_H
+#define LOT_H
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include "execution.h"
+
+/**
+ * @fn int traiterLot(char *source, char *methodesParDefaut, OptionsScrutin *options, int nbThreads, FILE *out, FILE *log)
+ * @brief Traite tous les fichiers d'un manifeste ou d'un motif.
+ * @param[in] source Chemin du manifeste, ou motif de fichiers s'il contient '*', '?' ou '['.
+ * @param[in] methodesParDefaut Méthodes des fichiers qui n'en précisent pas.
+ * @param[in] options Options du scrutin.
+ * @param[in] nbThreads Nombre de fichiers traités en parallèle.
+ * @param[out] out Fichier des résultats.
+ * @param[out] log Fichier de log, utilisé seulement en mode debug.
+ * @return Nombre de fichiers en erreur.
+ *
+ * @note La mémoire reste bornée : au plus nbThreads fichiers sont chargés à la fois, et un fichier
+ *       n'est commencé que si moins de 4 × nbThreads résultats attendent d'être affichés.
+ */
+int traiterLot(char *source, char *methodesParDefaut, OptionsScrutin *options, int nbThreads, FILE *out, FILE *log);
+
+#endif
@@ -13,12 +13,20 @@
 #include <getopt.h>
 #include <string.h>
 #include <stdbool.h>
+#include <unistd.h>
 
 #include "lecture_csv.h"
-#include "condorcet.h"
+#include "candidats.h"
+#include "lecture_duels.h"
 #include "jugement_majoritaire.h"
-#include "uninominales.h"
+#include "execution.h"
+#include "lot.h"
+#include "service.h"
+#include "statistiques.h"
 #include "utils.h"
+#include "journal.h"
+#include "trace.h"
+#include "simulation.h"
 
 ////////////////////////////////
 // -- Fonctions auxilières -- //
@@ -63,39 +71,166 @@ bool stringInArray(char *string, char *tab[], int lenTab){
 ////////////////////////////////////////////////////////
 
 /**
- * @fn void getParameters(int argc, char *argv[], bool *duel, char *inputFile, char *logFile, char *method)
+ * @struct Parametres
+ * @brief Paramètres de la ligne de commande.
+ */
+typedef struct Parametres {
+    bool duel;                 ///< Indicateur de duel.
+    char inputFile[MAXCHAR];   ///< Chemin du fichier d'entrée.
+    char logFile[MAXCHAR];     ///< Chemin du fichier de log.
+    char method[MAXCHAR];      ///< Méthodes, séparées par des virgules.
+    bool debugMode;            ///< Indicateur de mode debug.
+    bool earlyExit;            ///< Indicateur de dépouillement avec arrêt anticipé.
+    int nbSieges;              ///< Nombre de sièges à pourvoir (vote unique transférable).
+    EchelleMentions echelle;   ///< Échelle de mentions du jugement majoritaire (-g ou --scale).
+    char lot[MAXCHAR];         ///< Manifeste ou motif du mode lot, vide hors mode lot.
+    int nbThreads;             ///< Nombre de fichiers traités en parallèle en mode lot.
+    char serve[MAXCHAR];       ///< Chemin de la socket du mode service, vide hors mode service.
+    bool stats;                ///< Affichage des statistiques d'exécution sur la sortie d'erreur.
+    bool statsJson;            ///< Statistiques au format JSON plutôt qu'en texte.
+    bool perf;                 ///< Relevé des compteurs matériels par phase (implique --stats).
+    char trace[MAXCHAR];       ///< Chemin du fichier de trace des phases, vide sans trace.
+    long long simulate;        ///< Nombre d'élections simulées, 0 hors mode simulation.
+    Generateur modele;         ///< Modèle des élections simulées.
+} Parametres;
+
+/**
+ * @fn void getParameters(int argc, char *argv[], Parametres *params)
  * @brief Fonction de récupération des options et des arguments.
  * @param[in] argc Nombre d'arguments donnés.
  * @param[in] atgv Tableau d'arguments donnés.
- * @param[out] duel Indicateur de duel.
- * @param[out] inputFile Chemin du fichier d'entrée.
- * @param[out] logFile Chemin du fichier de log
- * @param[out] debugMode Indicateur de mode debug.
- * @param[out] method Nom de la méthode.
+ * @param[in, out] params Paramètres, initialisés à leurs valeurs par défaut.
  *
  * @note Cette fonction affiche un message d'erreur si une option n'est pas valide.
  */
-void getParameters(int argc, char *argv[], bool *duel, char *inputFile, char *logFile, bool *debugMode, char *method){
+void getParameters(int argc, char *argv[], Parametres *params){
+    static struct option optionsLongues[] = {
+        {"serve", required_argument, NULL, 'S'},
+        {"stats", optional_argument, NULL, 'T'},
+        {"perf", no_argument, NULL, 'P'},
+        {"log-level", required_argument, NULL, 'L'},
+        {"trace", required_argument, NULL, 'R'},
+        {"scale", required_argument, NULL, 'K'},
+        {"simulate", required_argument, NULL, 'U'},
+        {"candidates", required_argument, NULL, 'C'},
+        {"voters", required_argument, NULL, 'V'},
+        {"model", required_argument, NULL, 'M'},
+        {"model-param", required_argument, NULL, 'A'},
+        {"seed", required_argument, NULL, 'G'},
+        {NULL, 0, NULL, 0}
+    };
     int option;
-    while((option = getopt(argc, argv, "i:d:o:m:")) != -1){
+    while((option = getopt_long(argc, argv, "i:d:o:m:en:g:b:j:", optionsLongues, NULL)) != -1){
         switch(option){
             case 'i':
-                *duel = false;
-                strcpy(inputFile, optarg);
+                params->duel = false;
+                strcpy(params->inputFile, optarg);
                 break;
             case 'd':
-                *duel = true;
-                strcpy(inputFile, optarg);
+                params->duel = true;
+                strcpy(params->inputFile, optarg);
                 break;
             case 'o':
-                *debugMode = true;
-                strcpy(logFile, optarg);
+                params->debugMode = true;
+                strcpy(params->logFile, optarg);
                 break;
             case 'm':
-                strcpy(method, optarg);
+                strcpy(params->method, optarg);
+                break;
+            case 'e':
+                params->earlyExit = true;
+                break;
+            case 'n':
+                params->nbSieges = atoi(optarg);
+                if(params->nbSieges < 1){
+                    fprintf(stderr, "Usage: -n doit être un nombre de sièges strictement positif\n");
+                    exit(EXIT_FAILURE);
+                }
+                break;
+            case 'g':
+                if(echelleMentions(atoi(optarg)) == NULL){
+                    fprintf(stderr, "Usage: -g doit être un nombre de mentions dans [5, 6, 7, 10]\n");
+                    exit(EXIT_FAILURE);
+                }
+                params->echelle = *echelleMentions(atoi(optarg));
+                break;
+            case 'K':
+                if(!lireEchelleMentions(optarg, &params->echelle)){
+                    fprintf(stderr, "Usage: --scale mention,mention...[:mention du classement 1,...,mention du classement 10]\n");
+                    exit(EXIT_FAILURE);
+                }
+                break;
+            case 'b':
+                strcpy(params->lot, optarg);
+                break;
+            case 'j':
+                params->nbThreads = atoi(optarg);
+                if(params->nbThreads < 1){
+                    fprintf(stderr, "Usage: -j doit être un nombre de threads strictement positif\n");
+                    exit(EXIT_FAILURE);
+                }
+                break;
+            case 'S':
+                strcpy(params->serve, optarg);
+                break;
+            case 'T':
+                params->stats = true;
+                if(optarg != NULL && strcmp(optarg, "json") == 0){
+                    params->statsJson = true;
+                }
+                else if(optarg != NULL && strcmp(optarg, "text") != 0){
+                    fprintf(stderr, "Usage: --stats[=text|json]\n");
+                    exit(EXIT_FAILURE);
+                }
+                break;
+            case 'P':
+                params->stats = true;
+                params->perf = true;
+                break;
+            case 'R':
+                strcpy(params->trace, optarg);
+                break;
+            case 'L':
+                if(!lireNiveauJournal(optarg, &niveauJournal)){
+                    fprintf(stderr, "Usage: --log-level resultats|details|trace\n");
+                    exit(EXIT_FAILURE);
+                }
+                break;
+            case 'U':
+                params->simulate = atoll(optarg);
+                if(params->simulate < 1){
+                    fprintf(stderr, "Usage: --simulate doit être un nombre d'élections strictement positif\n");
+                    exit(EXIT_FAILURE);
+                }
+                break;
+            case 'C':
+                params->modele.nbCandidats = atoi(optarg);
+                break;
+            case 'V':
+                params->modele.nbVotants = atoll(optarg);
+                break;
+            case 'M':
+                if(!lireModele(optarg, &params->modele.modele)){
+                    fprintf(stderr, "Usage: --model ic|mallows|polya\n");
+                    exit(EXIT_FAILURE);
+                }
+                break;
+            case 'A':
+                params->modele.parametre = atof(optarg);
+                break;
+            case 'G':
+                params->modele.graine = strtoull(optarg, NULL, 10);
                 break;
             case '?':
-                fprintf(stderr, "Usage: -i|-d nom_fichier -m méthode [-o nom_fichier]\n");
+                fprintf(stderr, "Usage: -i|-d nom_fichier -m méthode[,méthode...] [-o nom_fichier] [-e] [-n sièges] [-g mentions]\n");
+                fprintf(stderr, "       -b manifeste|motif [-m méthode[,méthode...]] [-j threads] [-o nom_fichier] [-e] [-n sièges] [-g mentions]\n");
+                fprintf(stderr, "       --serve chemin_socket [-o nom_fichier] [-e] [-n sièges] [-g mentions]\n");
+                fprintf(stderr, "       --simulate élections [--candidates c] [--voters v] [--model ic|mallows|polya] [--model-param p] [--seed s] [-m méthode[,méthode...]] [-j threads]\n");
+                fprintf(stderr, "       --scale mention,mention...[:m1,...,m10] : échelle du jugement majoritaire, à la place de -g\n");
+                fprintf(stderr, "       --stats[=text|json] : durées par phase et compteurs, sur la sortie d'erreur\n");
+                fprintf(stderr, "       --perf : --stats avec cycles, instructions et défauts de cache et de prédiction par phase\n");
+                fprintf(stderr, "       --trace fichier.json : phases de chaque thread au format Chrome trace-event\n");
+                fprintf(stderr, "       --log-level resultats|details|trace : détail du fichier de log (-o), details par défaut\n");
                 exit(EXIT_FAILURE);
         }
     }
@@ -131,102 +266,136 @@ void checkParameters(bool duel, char *methods[], int lenMethods, char *inputFile
     }
 }
 
-////////////////////////////////////////////////////////
-// -- Fonctions de factorisation du code redondant -- //
-////////////////////////////////////////////////////////
-
-void affichageUninominaleDeuxTours(DataFrame *df, FILE *log, bool debugMode){
-    VoteResult firstTourFirstCandidate;
-    VoteResult firstTourSecondCandidate;
-    VoteResult secondTour;
-    bool majorite;
-
-    voteUninominalDeuxTours(df, log, debugMode, &firstTourFirstCandidate, &firstTourSecondCandidate, &secondTour, &majorite);
-
-    printResult(firstTourFirstCandidate, "uni2", 1);
-    if(!majorite){
-        printResult(firstTourSecondCandidate, "uni2", 1);
-    }
-    printResult(secondTour, "uni2", 2);
-
-}
-
 ////////////////
 // -- MAIN -- //
 ////////////////
 
 int main(int argc, char *argv[]) {
-    // Variables pour les paramètres de ligne de commande
-    bool duel = false;
-    char inputFile[MAXCHAR];
-    char logFile[MAXCHAR];
-    char method[MAXCHAR];
-    bool debugMode = false;
+    // Paramètres de ligne de commande, avec leurs valeurs par défaut
+    Parametres params = {0};
+    params.nbSieges = 2;
+    params.echelle = *echelleMentions(6);
+    params.nbThreads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    params.modele = (Generateur){.modele = IMPARTIAL, .nbCandidats = 5, .nbVotants = 101, .parametre = -1, .graine = 1};
+    if (params.nbThreads < 1) {
+        params.nbThreads = 1;
+    }
 
     // Récupérer les paramètres de la ligne de commande
-    getParameters(argc, argv, &duel, inputFile, logFile, &debugMode, method);
+    getParameters(argc, argv, &params);
+    if (params.stats) {
+        activerStatistiques(params.perf);
+    }
+    if (params.trace[0] != '\0') {
+        activerTrace(params.trace);
+    }
+    bool duel = params.duel;
+    char *inputFile = params.inputFile;
+    char *method = params.method;
+    bool debugMode = params.debugMode;
+
+    OptionsScrutin options = {debugMode, params.earlyExit, params.nbSieges, &params.echelle, false};
+    FILE *log = NULL;
+
+    // En mode lot, chaque fichier de la source est traité avec ses propres méthodes, "all" par défaut
+    // Mode simulation : élections tirées en mémoire, toutes les méthodes sur bulletins par défaut
+    if (params.simulate > 0) {
+        if (method[0] == '\0') {
+            strcpy(method, "all");
+        }
+        char *methodes[MAX_METHODES];
+        int nbMethodes = listerMethodes(method, false, methodes);
+        for (int i = 0; i < nbMethodes; i++) {
+            if (!methodeValide(methodes[i], false)) {
+                fprintf(stderr, "Usage: méthode inconnue : %s\n", methodes[i]);
+                exit(EXIT_FAILURE);
+            }
+        }
+        ParametresSimulation simulation = {params.simulate, params.modele, params.nbThreads};
+        int statut = simuler(&simulation, methodes, nbMethodes, &options, stdout);
+        if (params.stats) {
+            afficherStatistiques(stderr, params.statsJson);
+        }
+        ecrireTrace();
+        return statut;
+    }
+
+    if (params.lot[0] != '\0') {
+        if (debugMode) {
+            log = ouvrirJournalAsynchrone(openFileWrite(params.logFile));
+        }
+        int nbErreurs = traiterLot(params.lot, method[0] != '\0' ? method : "all", &options, params.nbThreads, stdout, log);
+        if (debugMode) {
+            fclose(log);
+        }
+        if (params.stats) {
+            afficherStatistiques(stderr, params.statsJson);
+        }
+        ecrireTrace();
+        return nbErreurs == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+    }
+
+    // En mode service, les élections restent en mémoire et les méthodes sont données par chaque demande
+    if (params.serve[0] != '\0') {
+        if (debugMode) {
+            log = ouvrirJournalAsynchrone(openFileWrite(params.logFile));
+        }
+        int statut = servir(params.serve, &options, log);
+        if (debugMode) {
+            fclose(log);
+        }
+        if (params.stats) {
+            afficherStatistiques(stderr, params.statsJson);
+        }
+        ecrireTrace();
+        return statut;
+    }
 
-    // Vérifier les paramètres en fonction du mode (duel ou non)
-    if (duel) {
-        char *methods[] = {"cm", "cp", "cs", "all"};
-        int lenMethods = 4;
-        checkParameters(duel, methods, lenMethods, inputFile, method);
-    } else {
-        char *methods[] = {"uni1", "uni2", "cm", "cp", "cs", "jm", "all"};
-        int lenMethods = 7;
-        checkParameters(duel, methods, lenMethods, inputFile, method);
+    // Découper la liste des méthodes, "all" étant remplacé par toutes les méthodes disponibles
+    char *methodes[MAX_METHODES];
+    int nbMethodes = listerMethodes(method, duel, methodes);
+    if (nbMethodes == 0) {
+        fprintf(stderr, "Usage: -i|-d et -m sont des méthodes obligatoires\n");
+        exit(EXIT_FAILURE);
+    }
+
+    // Vérifier chaque méthode en fonction du mode (duel ou non)
+    for (int i = 0; i < nbMethodes; i++) {
+        if (duel) {
+            char *methods[] = {"cm", "cp", "cs", "all"};
+            int lenMethods = 4;
+            checkParameters(duel, methods, lenMethods, inputFile, methodes[i]);
+        } else {
+            char *methods[] = {"uni1", "uni2", "cm", "cp", "cs", "jm", "irv", "stv", "borda", "dowdall", "anti", "bucklin", "all"};
+            int lenMethods = 13;
+            checkParameters(duel, methods, lenMethods, inputFile, methodes[i]);
+        }
     }
 
     // Ouvrir le fichier journal en mode écriture si le mode de débogage est activé
-    FILE *log;
     if (debugMode) {
-        log = openFileWrite(logFile);
-    }
-
-    // Créer une structure de données DataFrame à partir du fichier CSV passé
-    DataFrame *df = createDataFrameFromCsv(inputFile);
-
-    // Exécuter le système de vote en fonction de la méthode spécifiée
-    if (strcmp(method, "uni1") == 0) {
-        // Exécuter le vote uninominal à un tour
-        printResult(voteUninominalUnTour(df, log, debugMode, NULL), method, 1);
-    } else if (strcmp(method, "uni2") == 0) {
-        // Exécuter le vote uninominal à deux tours
-        affichageUninominaleDeuxTours(df, log, debugMode);
-    } else if (strcmp(method, "cm") == 0) {
-        // Exécuter le vote Condorcet Minimax
-        printResult(voteCondorcetMinimax(df, duel, log, debugMode), method, 1);
-    } else if (strcmp(method, "cp") == 0) {
-        // Exécuter le vote Condorcet Paires
-        printResult(voteCondorcetPaires(df, duel, log, debugMode), method, 1);
-    } else if (strcmp(method, "cs") == 0) {
-        // Exécuter le vote Condorcet Schulze
-        printResult(voteCondorcetSchulze(df, duel, log, debugMode), method, 1);
-    } else if (strcmp(method, "jm") == 0) {
-        // Exécuter le vote Jugement Majoritaire
-        printResult(voteJugementMajoritaire(df, log, debugMode), method, 1);
-    } else {
-        // Exécuter toutes les méthodes si la méthode spécifiée est "all"
-        if (!duel) {
-            // Exécuter le vote uninominal à un tour
-            printResult(voteUninominalUnTour(df, log, debugMode, NULL), "uni1", 1);
-            // Exécuter le vote uninominal à deux tours
-            affichageUninominaleDeuxTours(df, log, debugMode);
-            // Exécuter le vote Jugement Majoritaire
-            printResult(voteJugementMajoritaire(df, log, debugMode), "jm", 1);
-        }
-        // Exécuter le vote Condorcet Minimax
-        printResult(voteCondorcetMinimax(df, duel, log, debugMode), "cm", 1);
-        // Exécuter le vote Condorcet Paires
-        printResult(voteCondorcetPaires(df, duel, log, debugMode), "cp", 1);
-        // Exécuter le vote Condorcet Schulze
-        printResult(voteCondorcetSchulze(df, duel, log, debugMode), "cs", 1);
+        log = ouvrirJournalAsynchrone(openFileWrite(params.logFile));
     }
 
+    Election election;
+    if (!chargerElection(&election, inputFile, duel)) {
+        fprintf(stderr, "Erreur : %s.\n", erreurLecture());
+        exit(EXIT_FAILURE);
+    }
+
+    // Calculer une seule fois les structures partagées, puis exécuter les méthodes en parallèle
+    preparerElection(&election, methodes, nbMethodes, &options);
+    executerMethodes(&election, methodes, nbMethodes, &options, stdout, log);
+
     // Libérer la mémoire et fermer le fichier journal s'il est ouvert
+    fermerElection(&election);
     if(debugMode){
         fclose(log);
     }
+    if (params.stats) {
+        afficherStatistiques(stderr, params.statsJson);
+    }
+    ecrireTrace();
 
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,186 @@
+/**
+ * @file memoire.c
+ * @brief Suivi des allocations mémoire par phase (option --stats).
+ * @author Bibyk Bogdan
+ * @date 18 octobre 2026
+ *
+ * Ce fichier contient l'interception des fonctions d'allocation de la glibc. Chaque fonction
+ * appelle son équivalent __libc_* puis, si le suivi est actif, met à jour les compteurs du thread
+ * et la mémoire vivante du processus.
+ *
+ */
+
+#ifndef MEMOIRE_C
+#define MEMOIRE_C
+
+#include <errno.h>
+#include <stdatomic.h>
+#include <sys/resource.h>
+#include "memoire.h"
+
+#if defined(__GLIBC__) && !defined(__SANITIZE_ADDRESS__) && !defined(__SANITIZE_THREAD__)
+#define INTERCEPTION_MEMOIRE 1
+#include <malloc.h>
+#endif
+
+/// Indique si les allocations sont comptées.
+static bool suiviActif = false;
+/// Allocations du thread.
+static _Thread_local EtatMemoire etatThread;
+/// Octets vivants, tous threads confondus.
+static _Atomic int64_t vivant;
+/// Maximum atteint par vivant.
+static _Atomic int64_t picVivant;
+
+#ifdef INTERCEPTION_MEMOIRE
+
+extern void *__libc_malloc(size_t taille);
+extern void *__libc_calloc(size_t nombre, size_t taille);
+extern void *__libc_realloc(void *ptr, size_t taille);
+extern void __libc_free(void *ptr);
+extern void *__libc_memalign(size_t alignement, size_t taille);
+extern void *__libc_valloc(size_t taille);
+extern void *__libc_pvalloc(size_t taille);
+
+/**
+ * @fn static void compterAllocation(void *ptr)
+ * @brief Compte un bloc qui vient d'être alloué.
+ * @param[in] ptr Bloc, éventuellement NULL.
+ */
+static void compterAllocation(void *ptr)
+{
+    if (!suiviActif || ptr == NULL)
+        return;
+    size_t taille = malloc_usable_size(ptr);
+    etatThread.alloue += taille;
+    etatThread.allocations++;
+    int64_t courant = atomic_fetch_add_explicit(&vivant, (int64_t)taille, memory_order_relaxed) + (int64_t)taille;
+    int64_t pic = atomic_load_explicit(&picVivant, memory_order_relaxed);
+    while (courant > pic && !atomic_compare_exchange_weak_explicit(&picVivant, &pic, courant, memory_order_relaxed, memory_order_relaxed))
+        ;
+}
+
+/**
+ * @fn static void compterLiberation(void *ptr)
+ * @brief Compte un bloc sur le point d'être libéré.
+ * @param[in] ptr Bloc, éventuellement NULL.
+ */
+static void compterLiberation(void *ptr)
+{
+    if (!suiviActif || ptr == NULL)
+        return;
+    size_t taille = malloc_usable_size(ptr);
+    etatThread.libere += taille;
+    atomic_fetch_sub_explicit(&vivant, (int64_t)taille, memory_order_relaxed);
+}
+
+void *malloc(size_t taille)
+{
+    void *ptr = __libc_malloc(taille);
+    compterAllocation(ptr);
+    return ptr;
+}
+
+void *calloc(size_t nombre, size_t taille)
+{
+    void *ptr = __libc_calloc(nombre, taille);
+    compterAllocation(ptr);
+    return ptr;
+}
+
+void *realloc(void *ancien, size_t taille)
+{
+    // Le bloc peut être déplacé : il est compté comme libéré puis réalloué
+    compterLiberation(ancien);
+    void *ptr = __libc_realloc(ancien, taille);
+    if (ptr == NULL && taille > 0)
+        compterAllocation(ancien);
+    else
+        compterAllocation(ptr);
+    return ptr;
+}
+
+void free(void *ptr)
+{
+    compterLiberation(ptr);
+    __libc_free(ptr);
+}
+
+void *memalign(size_t alignement, size_t taille)
+{
+    void *ptr = __libc_memalign(alignement, taille);
+    compterAllocation(ptr);
+    return ptr;
+}
+
+void *aligned_alloc(size_t alignement, size_t taille)
+{
+    return memalign(alignement, taille);
+}
+
+int posix_memalign(void **resultat, size_t alignement, size_t taille)
+{
+    if (alignement % sizeof(void *) != 0 || (alignement & (alignement - 1)) != 0)
+        return EINVAL;
+    void *ptr = memalign(alignement, taille);
+    if (ptr == NULL)
+        return ENOMEM;
+    *resultat = ptr;
+    return 0;
+}
+
+void *valloc(size_t taille)
+{
+    void *ptr = __libc_valloc(taille);
+    compterAllocation(ptr);
+    return ptr;
+}
+
+void *pvalloc(size_t taille)
+{
+    void *ptr = __libc_pvalloc(taille);
+    compterAllocation(ptr);
+    return ptr;
+}
+
+#endif // INTERCEPTION_MEMOIRE
+
+/**
+ * @fn bool activerSuiviMemoire(void)
+ * @brief Active le comptage des allocations.
+ * @return false si l'interception n'est pas disponible dans cette compilation.
+ */
+bool activerSuiviMemoire(void)
+{
+#ifdef INTERCEPTION_MEMOIRE
+    suiviActif = true;
+#endif
+    return suiviActif;
+}
+
+/**
+ * @fn EtatMemoire lireMemoireThread(void)
+ * @brief Allocations cumulées du thread appelant.
+ * @return État du thread.
+ */
+EtatMemoire lireMemoireThread(void)
+{
+    return etatThread;
+}
+
+/**
+ * @fn void lireMemoireGlobale(int64_t *vivantTotal, int64_t *pic, long *picRss)
+ * @brief Mémoire du processus.
+ * @param[out] vivantTotal Octets alloués et non libérés depuis l'activation, tous threads confondus.
+ * @param[out] pic Maximum de vivantTotal depuis l'activation.
+ * @param[out] picRss Pic de mémoire résidente du processus, en kilo-octets.
+ */
+void lireMemoireGlobale(int64_t *vivantTotal, int64_t *pic, long *picRss)
+{
+    struct rusage usage;
+    *vivantTotal = atomic_load(&vivant);
+    *pic = atomic_load(&picVivant);
+    *picRss = getrusage(RUSAGE_SELF, &usage) == 0 ? usage.ru_maxrss : 0;
+}
+
+#endif // MEMOIRE_C
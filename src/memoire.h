@@ -0,0 +1,62 @@
+/**
+ * @file memoire.h
+ * @brief Suivi des allocations mémoire par phase (option --stats).
+ * @author Bibyk Bogdan
+ * @date 18 octobre 2026
+ *
+ * Ce fichier d'en-tête définit le suivi des allocations. malloc, calloc, realloc, free et les
+ * allocations alignées sont interceptés au niveau de l'édition des liens et comptés par thread :
+ * une phase mesure ce que son thread a alloué et libéré entre son début et sa fin. La mémoire
+ * retenue par une phase (allouée mais pas libérée) indique le sous-système qui la détient : le
+ * DataFrame pour le chargement, la matrice pour les duels... et une fuite pour une méthode.
+ *
+ * Aucun en-tête n'est ajouté aux blocs : la taille est lue avec malloc_usable_size, si bien que les
+ * blocs alloués avant l'activation du suivi peuvent être libérés sans précaution.
+ *
+ * @note L'interception n'existe qu'avec la glibc, hors compilation avec -fsanitize=address ou
+ *       -fsanitize=thread, qui interceptent déjà ces fonctions.
+ */
+
+#ifndef MEMOIRE_H
+#define MEMOIRE_H
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+/**
+ * @struct EtatMemoire
+ * @brief Allocations cumulées d'un thread depuis son démarrage.
+ */
+typedef struct EtatMemoire
+{
+    uint64_t alloue;       ///< Octets alloués.
+    uint64_t libere;       ///< Octets libérés.
+    uint64_t allocations;  ///< Nombre d'allocations.
+} EtatMemoire;
+
+/**
+ * @fn bool activerSuiviMemoire(void)
+ * @brief Active le comptage des allocations.
+ * @return false si l'interception n'est pas disponible dans cette compilation.
+ */
+bool activerSuiviMemoire(void);
+
+/**
+ * @fn EtatMemoire lireMemoireThread(void)
+ * @brief Allocations cumulées du thread appelant.
+ * @return État du thread.
+ */
+EtatMemoire lireMemoireThread(void);
+
+/**
+ * @fn void lireMemoireGlobale(int64_t *vivantTotal, int64_t *pic, long *picRss)
+ * @brief Mémoire du processus.
+ * @param[out] vivantTotal Octets alloués et non libérés depuis l'activation, tous threads confondus.
+ * @param[out] pic Maximum de vivantTotal depuis l'activation.
+ * @param[out] picRss Pic de mémoire résidente du processus, en kilo-octets.
+ */
+void lireMemoireGlobale(int64_t *vivantTotal, int64_t *pic, long *picRss);
+
+#endif
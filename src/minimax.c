@@ -0,0 +1,237 @@
+/**
+ * @file minimax.c
+ * @brief Variantes de la méthode Condorcet minimax calculées ensemble à partir de la matrice des duels.
+ * @author Bibyk Bogdan
+ * @date 18 octobre 2026
+ *
+ * Ce fichier contient l'implémentation du calcul simultané des variantes de minimax.
+ * Chaque paire (i, j) n'est lue qu'une fois et met à jour les trois scores des deux candidats.
+ *
+ */
+
+#ifndef MINIMAX_C
+#define MINIMAX_C
+
+#include "minimax.h"
+
+/**
+ * @fn static void *allocMinimaxMem(size_t size)
+ * @brief Fonction d'allocation mémoire initialisée à zéro, avec arrêt du programme en cas d'échec.
+ * @param[in] size Taille à allouer.
+ * @return Pointeur vers la mémoire allouée.
+ */
+static void *allocMinimaxMem(size_t size)
+{
+    void *ptr = calloc(1, size);
+    if (ptr == NULL)
+    {
+        perror("Erreur d'allocation mémoire");
+        exit(EXIT_FAILURE);
+    }
+    return ptr;
+}
+
+/**
+ * @fn void enregistrerDuelMinimax(ResultatsMinimax *resultats, int candidat, int voix_pour, int voix_contre)
+ * @brief Met à jour les trois scores d'un candidat face à un adversaire.
+ * @param[in, out] resultats Résultats minimax.
+ * @param[in] candidat Identifiant du candidat.
+ * @param[in] voix_pour Nombre d'électeurs préférant le candidat à l'adversaire.
+ * @param[in] voix_contre Nombre d'électeurs préférant l'adversaire au candidat.
+ */
+void enregistrerDuelMinimax(ResultatsMinimax *resultats, int candidat, int voix_pour, int voix_contre)
+{
+    int votes_gagnants = voix_contre > voix_pour ? voix_contre : 0;
+    int marge = voix_contre - voix_pour;
+
+    if (votes_gagnants > resultats->scores[MINIMAX_VOTES_GAGNANTS][candidat])
+        resultats->scores[MINIMAX_VOTES_GAGNANTS][candidat] = votes_gagnants;
+    if (marge > resultats->scores[MINIMAX_MARGES][candidat])
+        resultats->scores[MINIMAX_MARGES][candidat] = marge;
+    if (voix_contre > resultats->scores[MINIMAX_OPPOSITION][candidat])
+        resultats->scores[MINIMAX_OPPOSITION][candidat] = voix_contre;
+}
+
+/**
+ * @fn static void classer(int *scores, int *classement, int nb_candidates)
+ * @brief Tri par insertion stable des candidats par pire défaite croissante.
+ * @param[in] scores Pire défaite de chaque candidat.
+ * @param[out] classement Candidats du meilleur au moins bon.
+ * @param[in] nb_candidates Nombre de candidats.
+ */
+static void classer(int *scores, int *classement, int nb_candidates)
+{
+    for (int i = 0; i < nb_candidates; i++)
+    {
+        int p = i;
+        while (p > 0 && scores[classement[p - 1]] > scores[i])
+        {
+            classement[p] = classement[p - 1];
+            p--;
+        }
+        classement[p] = i;
+    }
+}
+
+/**
+ * @fn static int margeInitiale(DuelMatrix *duels)
+ * @brief Pire défaite de départ pour les marges, plus petite que toute marge possible.
+ * @param[in] duels Matrice des duels.
+ * @return Valeur de départ, 0 pour un candidat seul.
+ */
+static int margeInitiale(DuelMatrix *duels)
+{
+    return duels->nb_candidates > 1 ? -duels->nb_ballots - 1 : 0;
+}
+
+/**
+ * @fn ResultatsMinimax *calculerMinimax(DuelMatrix *duels)
+ * @brief Calcul des trois variantes en un seul parcours de la matrice des duels, en O(C²).
+ * @param[in] duels Matrice des duels.
+ * @return Scores et classements des trois variantes.
+ */
+ResultatsMinimax *calculerMinimax(DuelMatrix *duels)
+{
+    int nb_candidates = duels->nb_candidates;
+    ResultatsMinimax *resultats = allocMinimaxMem(sizeof(ResultatsMinimax));
+    resultats->nb_candidates = nb_candidates;
+
+    for (int v = 0; v < NB_VARIANTES_MINIMAX; v++)
+    {
+        resultats->scores[v] = allocMinimaxMem((nb_candidates + 1) * sizeof(int));
+        resultats->classements[v] = allocMinimaxMem((nb_candidates + 1) * sizeof(int));
+    }
+
+    // La marge peut être négative : on part de la plus petite valeur possible
+    for (int i = 0; i < nb_candidates; i++)
+        resultats->scores[MINIMAX_MARGES][i] = margeInitiale(duels);
+
+    // Chaque paire n'est lue qu'une fois, pour les deux candidats
+    for (int i = 0; i < nb_candidates; i++)
+    {
+        for (int j = i + 1; j < nb_candidates; j++)
+        {
+            int ij = DUEL_WINS(duels, i, j);
+            int ji = DUEL_WINS(duels, j, i);
+            enregistrerDuelMinimax(resultats, i, ij, ji);
+            enregistrerDuelMinimax(resultats, j, ji, ij);
+        }
+    }
+
+    classerMinimax(resultats);
+    return resultats;
+}
+
+/**
+ * @fn void recalculerMinimaxCandidat(ResultatsMinimax *resultats, DuelMatrix *duels, int candidat)
+ * @brief Recalcul des trois scores d'un candidat contre tous ses adversaires, en O(C).
+ * @param[in, out] resultats Résultats minimax.
+ * @param[in] duels Matrice des duels.
+ * @param[in] candidat Identifiant du candidat.
+ */
+void recalculerMinimaxCandidat(ResultatsMinimax *resultats, DuelMatrix *duels, int candidat)
+{
+    resultats->scores[MINIMAX_VOTES_GAGNANTS][candidat] = 0;
+    resultats->scores[MINIMAX_MARGES][candidat] = margeInitiale(duels);
+    resultats->scores[MINIMAX_OPPOSITION][candidat] = 0;
+    for (int j = 0; j < duels->nb_candidates; j++)
+    {
+        if (j != candidat)
+            enregistrerDuelMinimax(resultats, candidat, DUEL_WINS(duels, candidat, j), DUEL_WINS(duels, j, candidat));
+    }
+}
+
+/**
+ * @fn void classerMinimax(ResultatsMinimax *resultats)
+ * @brief Classement des candidats de chaque variante à partir de leurs scores, en O(C²).
+ * @param[in, out] resultats Résultats minimax.
+ */
+void classerMinimax(ResultatsMinimax *resultats)
+{
+    for (int v = 0; v < NB_VARIANTES_MINIMAX; v++)
+        classer(resultats->scores[v], resultats->classements[v], resultats->nb_candidates);
+}
+
+/**
+ * @fn char *nomVarianteMinimax(VarianteMinimax variante)
+ * @brief Nom lisible d'une variante.
+ * @param[in] variante Variante de minimax.
+ * @return Nom de la variante.
+ */
+char *nomVarianteMinimax(VarianteMinimax variante)
+{
+    switch (variante)
+    {
+    case MINIMAX_VOTES_GAGNANTS:
+        return "votes gagnants";
+    case MINIMAX_MARGES:
+        return "marges";
+    case MINIMAX_OPPOSITION:
+        return "opposition";
+    default:
+        return "inconnue";
+    }
+}
+
+/**
+ * @fn int scoreMinimax(ResultatsMinimax *resultats, VarianteMinimax variante, int candidat)
+ * @brief Score affiché d'un candidat : sa pire défaite, ou pour les marges sa marge minimale face à ses adversaires.
+ * @param[in] resultats Résultats minimax.
+ * @param[in] variante Variante de minimax.
+ * @param[in] candidat Identifiant du candidat.
+ * @return Score du candidat.
+ */
+int scoreMinimax(ResultatsMinimax *resultats, VarianteMinimax variante, int candidat)
+{
+    int score = resultats->scores[variante][candidat];
+    return variante == MINIMAX_MARGES ? -score : score;
+}
+
+/**
+ * @fn static char *libelleScoreMinimax(VarianteMinimax variante)
+ * @brief Libellé du score affiché d'une variante.
+ * @param[in] variante Variante de minimax.
+ * @return Libellé du score.
+ */
+static char *libelleScoreMinimax(VarianteMinimax variante)
+{
+    return variante == MINIMAX_MARGES ? "marge minimale" : "pire défaite";
+}
+
+/**
+ * @fn void printMinimax(ResultatsMinimax *resultats, CandidateTable *candidates, FILE *file)
+ * @brief Affichage des classements complets des trois variantes.
+ * @param[in] resultats Résultats minimax.
+ * @param[in] candidates Table des candidats.
+ * @param[out] file Fichier de sortie.
+ */
+void printMinimax(ResultatsMinimax *resultats, CandidateTable *candidates, FILE *file)
+{
+    for (int v = 0; v < NB_VARIANTES_MINIMAX; v++)
+    {
+        fprintf(file, "Classement MINI MAX (%s) :\n", nomVarianteMinimax(v));
+        for (int r = 0; r < resultats->nb_candidates; r++)
+        {
+            int candidat = resultats->classements[v][r];
+            fprintf(file, "\t%d. %s (%s : %d)\n", r + 1, candidates->names[candidat], libelleScoreMinimax(v), scoreMinimax(resultats, v, candidat));
+        }
+    }
+    fprintf(file, "\n");
+}
+
+/**
+ * @fn void deleteResultatsMinimax(ResultatsMinimax *resultats)
+ * @brief Libération des résultats minimax.
+ * @param[in] resultats Résultats minimax.
+ */
+void deleteResultatsMinimax(ResultatsMinimax *resultats)
+{
+    for (int v = 0; v < NB_VARIANTES_MINIMAX; v++)
+    {
+        free(resultats->scores[v]);
+        free(resultats->classements[v]);
+    }
+    free(resultats);
+}
+
+#endif // MINIMAX_C
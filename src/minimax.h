@@ -0,0 +1,122 @@
+/**
+ * @file minimax.h
+ * @brief Variantes de la méthode Condorcet minimax calculées ensemble à partir de la matrice des duels.
+ * @author Bibyk Bogdan
+ * @date 18 octobre 2026
+ *
+ * Ce fichier d'en-tête définit le calcul simultané des trois variantes classiques de minimax :
+ * - votes gagnants : pire défaite mesurée par le nombre de voix de l'adversaire, 0 si aucune défaite ;
+ * - marges : pire défaite mesurée par la marge de l'adversaire ;
+ * - opposition : plus grand nombre d'électeurs préférant un adversaire, défaite ou non.
+ * Dans les trois cas, le vainqueur est le candidat dont la pire défaite est la plus faible. Pour les
+ * marges, le score affiché est l'opposé de la pire défaite : la marge minimale face aux adversaires.
+ *
+ */
+
+#ifndef MINIMAX_H
+#define MINIMAX_H
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include "duels.h"
+#include "candidats.h"
+
+/**
+ * @enum VarianteMinimax
+ * @brief Variantes de la méthode minimax.
+ */
+typedef enum VarianteMinimax
+{
+    MINIMAX_VOTES_GAGNANTS, ///< Votes gagnants.
+    MINIMAX_MARGES,         ///< Marges.
+    MINIMAX_OPPOSITION,     ///< Opposition par paires.
+    NB_VARIANTES_MINIMAX    ///< Nombre de variantes.
+} VarianteMinimax;
+
+/**
+ * @struct ResultatsMinimax
+ * @brief Scores et classements complets des trois variantes.
+ */
+typedef struct ResultatsMinimax
+{
+    int nb_candidates;                          ///< Nombre de candidats.
+    int *scores[NB_VARIANTES_MINIMAX];          ///< Pire défaite de chaque candidat, par variante.
+    int *classements[NB_VARIANTES_MINIMAX];     ///< Candidats du meilleur au moins bon, par variante.
+} ResultatsMinimax;
+
+/**
+ * @fn ResultatsMinimax *calculerMinimax(DuelMatrix *duels)
+ * @brief Calcul des trois variantes en un seul parcours de la matrice des duels, en O(C²).
+ * @param[in] duels Matrice des duels.
+ * @return Scores et classements des trois variantes.
+ *
+ * @note À score égal, les candidats restent dans l'ordre de leurs identifiants.
+ */
+ResultatsMinimax *calculerMinimax(DuelMatrix *duels);
+
+/**
+ * @fn void enregistrerDuelMinimax(ResultatsMinimax *resultats, int candidat, int voix_pour, int voix_contre)
+ * @brief Met à jour les trois scores d'un candidat face à un adversaire, en O(1).
+ * @param[in, out] resultats Résultats minimax.
+ * @param[in] candidat Identifiant du candidat.
+ * @param[in] voix_pour Nombre d'électeurs préférant le candidat à l'adversaire.
+ * @param[in] voix_contre Nombre d'électeurs préférant l'adversaire au candidat.
+ *
+ * @note Les scores ne peuvent qu'augmenter : un duel dont les voix contre ont baissé demande un recalcul du candidat.
+ */
+void enregistrerDuelMinimax(ResultatsMinimax *resultats, int candidat, int voix_pour, int voix_contre);
+
+/**
+ * @fn void recalculerMinimaxCandidat(ResultatsMinimax *resultats, DuelMatrix *duels, int candidat)
+ * @brief Recalcul des trois scores d'un candidat contre tous ses adversaires, en O(C).
+ * @param[in, out] resultats Résultats minimax.
+ * @param[in] duels Matrice des duels.
+ * @param[in] candidat Identifiant du candidat.
+ */
+void recalculerMinimaxCandidat(ResultatsMinimax *resultats, DuelMatrix *duels, int candidat);
+
+/**
+ * @fn void classerMinimax(ResultatsMinimax *resultats)
+ * @brief Classement des candidats de chaque variante à partir de leurs scores, en O(C²).
+ * @param[in, out] resultats Résultats minimax.
+ *
+ * @note À score égal, les candidats restent dans l'ordre de leurs identifiants.
+ */
+void classerMinimax(ResultatsMinimax *resultats);
+
+/**
+ * @fn char *nomVarianteMinimax(VarianteMinimax variante)
+ * @brief Nom lisible d'une variante.
+ * @param[in] variante Variante de minimax.
+ * @return Nom de la variante.
+ */
+char *nomVarianteMinimax(VarianteMinimax variante);
+
+/**
+ * @fn int scoreMinimax(ResultatsMinimax *resultats, VarianteMinimax variante, int candidat)
+ * @brief Score affiché d'un candidat : sa pire défaite, ou pour les marges sa marge minimale face à ses adversaires.
+ * @param[in] resultats Résultats minimax.
+ * @param[in] variante Variante de minimax.
+ * @param[in] candidat Identifiant du candidat.
+ * @return Score du candidat, le même dans le classement et pour le vainqueur.
+ */
+int scoreMinimax(ResultatsMinimax *resultats, VarianteMinimax variante, int candidat);
+
+/**
+ * @fn void printMinimax(ResultatsMinimax *resultats, CandidateTable *candidates, FILE *file)
+ * @brief Affichage des classements complets des trois variantes.
+ * @param[in] resultats Résultats minimax.
+ * @param[in] candidates Table des candidats.
+ * @param[out] file Fichier de sortie.
+ */
+void printMinimax(ResultatsMinimax *resultats, CandidateTable *candidates, FILE *file);
+
+/**
+ * @fn void deleteResultatsMinimax(ResultatsMinimax *resultats)
+ * @brief Libération des résultats minimax.
+ * @param[in] resultats Résultats minimax.
+ */
+void deleteResultatsMinimax(ResultatsMinimax *resultats);
+
+#endif
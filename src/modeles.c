@@ -0,0 +1,261 @@
+/**
+ * @file modeles.c
+ * @brief Modèles de préférences des élections synthétiques (gen_ballots et option --simulate).
+ * @author Bibyk Bogdan
+ * @date 18 octobre 2026
+ *
+ * Ce fichier contient les tirages aléatoires (splitmix64) et les modèles de préférences.
+ * Extrait de gen_ballots.c sans changement de tirage : les fichiers générés restent identiques.
+ *
+ */
+
+#ifndef MODELES_C
+#define MODELES_C
+
+#include <string.h>
+#include "modeles.h"
+
+////////////////////////////
+// -- Tirages aléatoires -- //
+////////////////////////////
+
+/**
+ * @fn static uint64_t melanger(uint64_t x)
+ * @brief Fonction de mélange de splitmix64.
+ * @param[in] x Valeur à mélanger.
+ * @return Valeur mélangée.
+ */
+static uint64_t melanger(uint64_t x)
+{
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
+/**
+ * @fn uint64_t tirageSuivant(uint64_t *etat)
+ * @brief Tire 64 bits aléatoires (splitmix64).
+ * @param[in, out] etat État du générateur.
+ * @return Nombre aléatoire.
+ */
+uint64_t tirageSuivant(uint64_t *etat)
+{
+    *etat += 0x9E3779B97F4A7C15ULL;
+    return melanger(*etat);
+}
+
+/**
+ * @fn static double reel(uint64_t *etat)
+ * @brief Tire un réel uniforme dans [0, 1[.
+ * @param[in, out] etat État du générateur.
+ * @return Nombre aléatoire.
+ */
+static double reel(uint64_t *etat)
+{
+    return (tirageSuivant(etat) >> 11) * 0x1.0p-53;
+}
+
+/**
+ * @fn uint64_t fluxAleatoire(uint64_t graine, uint64_t domaine, uint64_t numero)
+ * @brief État initial d'un flux aléatoire indépendant.
+ * @param[in] graine Graine de la génération.
+ * @param[in] domaine Usage du flux (1 à 3 sont réservés aux bulletins).
+ * @param[in] numero Numéro du bulletin ou de l'élection.
+ * @return État initial.
+ */
+uint64_t fluxAleatoire(uint64_t graine, uint64_t domaine, uint64_t numero)
+{
+    return melanger(graine ^ melanger(domaine ^ melanger(numero + 1)));
+}
+
+//////////////////////////////////
+// -- Modèles de préférences -- //
+//////////////////////////////////
+
+/**
+ * @fn bool lireModele(const char *nom, Modele *modele)
+ * @brief Convertit un nom de modèle (ic, mallows, polya).
+ * @param[in] nom Nom du modèle.
+ * @param[out] modele Modèle correspondant.
+ * @return false si le nom n'est pas reconnu.
+ */
+bool lireModele(const char *nom, Modele *modele)
+{
+    if (strcmp(nom, "ic") == 0)
+        *modele = IMPARTIAL;
+    else if (strcmp(nom, "mallows") == 0)
+        *modele = MALLOWS;
+    else if (strcmp(nom, "polya") == 0)
+        *modele = POLYA;
+    else
+        return false;
+    return true;
+}
+
+/**
+ * @fn static void preparerMallows(Generateur *gen)
+ * @brief Calcule les probabilités cumulées du modèle d'insertion répétée de Mallows.
+ * @param[in, out] gen Générateur.
+ *
+ * @details Le candidat i est inséré à la position j (0 <= j <= i) du classement en cours avec une
+ *          probabilité proportionnelle à phi^(i - j) : la position la plus basse respecte l'ordre de référence.
+ */
+static void preparerMallows(Generateur *gen)
+{
+    int c = gen->nbCandidats;
+    if (gen->insertion != NULL)
+        return;
+    gen->insertion = malloc((size_t)c * c * sizeof(double));
+    if (gen->insertion == NULL)
+    {
+        perror("Erreur d'allocation mémoire");
+        exit(EXIT_FAILURE);
+    }
+    for (int i = 0; i < c; i++)
+    {
+        double *ligne = &gen->insertion[(size_t)i * c];
+        double poids = 1;
+        double total = 0;
+        for (int j = i; j >= 0; j--)
+        {
+            ligne[j] = poids;
+            total += poids;
+            poids *= gen->parametre;
+        }
+        double cumul = 0;
+        for (int j = 0; j <= i; j++)
+        {
+            cumul += ligne[j] / total;
+            ligne[j] = cumul;
+        }
+        ligne[i] = 1;
+    }
+}
+
+/**
+ * @fn static void preparerPolya(Generateur *gen)
+ * @brief Tire, pour chaque bulletin de l'urne de Pólya, le bulletin dont il est la copie.
+ * @param[in, out] gen Générateur.
+ *
+ * @details Le bulletin i est nouveau avec une probabilité 1 / (1 + alpha i), sinon il recopie un
+ *          bulletin précédent tiré uniformément. Seule l'origine de chaque bulletin est gardée.
+ */
+static void preparerPolya(Generateur *gen)
+{
+    if (gen->racines == NULL)
+        gen->racines = malloc(gen->nbVotants * sizeof(uint32_t));
+    if (gen->racines == NULL)
+    {
+        perror("Erreur d'allocation mémoire");
+        exit(EXIT_FAILURE);
+    }
+    uint64_t etat = fluxAleatoire(gen->graine, 3, 0);
+    for (long long i = 0; i < gen->nbVotants; i++)
+    {
+        if (reel(&etat) * (1 + gen->parametre * i) < 1)
+            gen->racines[i] = (uint32_t)i;
+        else
+            gen->racines[i] = gen->racines[(long long)(reel(&etat) * i)];
+    }
+}
+
+/**
+ * @fn void tirerClassement(Generateur *gen, long long votant, int *ordre, int *rangs)
+ * @brief Tire le bulletin d'un votant.
+ * @param[in] gen Générateur préparé.
+ * @param[in] votant Numéro du bulletin.
+ * @param[out] ordre Tampon de nbCandidats entiers.
+ * @param[out] rangs Rang de chaque candidat (à partir de 1), ou sa mention, -1 s'il n'est pas classé.
+ */
+void tirerClassement(Generateur *gen, long long votant, int *ordre, int *rangs)
+{
+    int c = gen->nbCandidats;
+    long long origine = gen->modele == POLYA ? gen->racines[votant] : votant;
+    uint64_t etat = fluxAleatoire(gen->graine, 1, origine);
+
+    if (gen->modele == MALLOWS)
+    {
+        // Insertion répétée : le candidat i prend la position j, les suivants sont décalés
+        for (int i = 0; i < c; i++)
+        {
+            const double *ligne = &gen->insertion[(size_t)i * c];
+            double u = reel(&etat);
+            int j = 0;
+            while (ligne[j] <= u && j < i)
+                j++;
+            memmove(&ordre[j + 1], &ordre[j], (i - j) * sizeof(int));
+            ordre[j] = i;
+        }
+    }
+    else
+    {
+        // Permutation uniforme de Fisher-Yates
+        for (int i = 0; i < c; i++)
+            ordre[i] = i;
+        for (int i = c - 1; i > 0; i--)
+        {
+            int j = (int)(reel(&etat) * (i + 1));
+            int t = ordre[i];
+            ordre[i] = ordre[j];
+            ordre[j] = t;
+        }
+    }
+
+    // Les abstentions sont propres au votant, même lorsque son classement est une copie
+    uint64_t etatVotant = fluxAleatoire(gen->graine, 2, votant);
+    for (int p = 0; p < c; p++)
+    {
+        int rang = p + 1;
+        if (gen->nbMentions > 0)
+            rang = 1 + p * gen->nbMentions / c;
+        if (gen->abstention > 0 && reel(&etatVotant) < gen->abstention)
+            rang = -1;
+        rangs[ordre[p]] = rang;
+    }
+}
+
+/**
+ * @fn bool completerGenerateur(Generateur *gen)
+ * @brief Donne au paramètre du modèle sa valeur par défaut s'il est négatif, puis vérifie les paramètres.
+ * @param[in, out] gen Générateur (phi = 0.5 pour Mallows, alpha = 1 pour Pólya par défaut).
+ * @return false si un paramètre est hors de son domaine.
+ */
+bool completerGenerateur(Generateur *gen)
+{
+    if (gen->modele == MALLOWS && gen->parametre < 0)
+        gen->parametre = 0.5;
+    if (gen->modele == POLYA && gen->parametre < 0)
+        gen->parametre = 1;
+    if (gen->nbCandidats < 2 || gen->nbVotants < 1 || gen->abstention < 0 || gen->abstention > 1 || gen->nbMentions < 0)
+        return false;
+    // Les origines des bulletins de Pólya sont des entiers de 32 bits
+    return !(gen->modele == MALLOWS && (gen->parametre <= 0 || gen->parametre > 1)) && !(gen->modele == POLYA && gen->nbVotants > UINT32_MAX);
+}
+
+/**
+ * @fn void preparerGenerateur(Generateur *gen)
+ * @brief Calcule les tables du modèle : probabilités d'insertion de Mallows, origines des bulletins de Pólya.
+ * @param[in, out] gen Générateur, dont les tables sont allouées si elles sont encore NULL.
+ */
+void preparerGenerateur(Generateur *gen)
+{
+    if (gen->modele == MALLOWS)
+        preparerMallows(gen);
+    if (gen->modele == POLYA)
+        preparerPolya(gen);
+}
+
+/**
+ * @fn void libererGenerateur(Generateur *gen)
+ * @brief Libère les tables du modèle.
+ * @param[in, out] gen Générateur.
+ */
+void libererGenerateur(Generateur *gen)
+{
+    free(gen->insertion);
+    free(gen->racines);
+    gen->insertion = NULL;
+    gen->racines = NULL;
+}
+
+#endif // MODELES_C
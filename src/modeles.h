@@ -0,0 +1,115 @@
+/**
+ * @file modeles.h
+ * @brief Modèles de préférences des élections synthétiques (gen_ballots et option --simulate).
+ * @author Bibyk Bogdan
+ * @date 18 octobre 2026
+ *
+ * Ce fichier d'en-tête définit le tirage de bulletins aléatoires. Modèles de préférences :
+ * - ic : culture impartiale, chaque classement est tiré uniformément ;
+ * - mallows : classements concentrés autour de Candidat 1 > Candidat 2 > ..., de dispersion phi dans ]0, 1] ;
+ * - polya : urne de Pólya-Eggenberger, chaque bulletin recopie un bulletin précédent avec une
+ *   probabilité qui croît avec le paramètre alpha (alpha = 0 revient à la culture impartiale).
+ *
+ * Chaque bulletin est tiré à partir de la graine et de son numéro seulement (flux splitmix64
+ * indépendants) : le résultat ne dépend ni de l'ordre des tirages ni du nombre de threads.
+ *
+ */
+
+#ifndef MODELES_H
+#define MODELES_H
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * @enum Modele
+ * @brief Modèles de préférences disponibles.
+ */
+typedef enum Modele
+{
+    IMPARTIAL, ///< Culture impartiale.
+    MALLOWS,   ///< Modèle de Mallows.
+    POLYA      ///< Urne de Pólya-Eggenberger.
+} Modele;
+
+/**
+ * @struct Generateur
+ * @brief Paramètres de la génération, partagés en lecture seule par les threads.
+ */
+typedef struct Generateur
+{
+    Modele modele;         ///< Modèle de préférences.
+    int nbCandidats;       ///< Nombre de candidats.
+    long long nbVotants;   ///< Nombre de bulletins.
+    double parametre;      ///< Dispersion phi (Mallows) ou taux de recopie alpha (Pólya).
+    double abstention;     ///< Probabilité qu'un candidat ne soit pas classé (-1).
+    int nbMentions;        ///< Nombre de mentions du jugement majoritaire, 0 pour des classements.
+    uint64_t graine;       ///< Graine.
+    double *insertion;     ///< Mallows : probabilités cumulées d'insertion, nbCandidats x nbCandidats.
+    uint32_t *racines;     ///< Pólya : bulletin d'origine de chaque bulletin.
+} Generateur;
+
+/**
+ * @fn uint64_t tirageSuivant(uint64_t *etat)
+ * @brief Tire 64 bits aléatoires (splitmix64).
+ * @param[in, out] etat État du générateur.
+ * @return Nombre aléatoire.
+ */
+uint64_t tirageSuivant(uint64_t *etat);
+
+/**
+ * @fn uint64_t fluxAleatoire(uint64_t graine, uint64_t domaine, uint64_t numero)
+ * @brief État initial d'un flux aléatoire indépendant.
+ * @param[in] graine Graine de la génération.
+ * @param[in] domaine Usage du flux (1 à 3 sont réservés aux bulletins).
+ * @param[in] numero Numéro du bulletin ou de l'élection.
+ * @return État initial.
+ */
+uint64_t fluxAleatoire(uint64_t graine, uint64_t domaine, uint64_t numero);
+
+/**
+ * @fn bool lireModele(const char *nom, Modele *modele)
+ * @brief Convertit un nom de modèle (ic, mallows, polya).
+ * @param[in] nom Nom du modèle.
+ * @param[out] modele Modèle correspondant.
+ * @return false si le nom n'est pas reconnu.
+ */
+bool lireModele(const char *nom, Modele *modele);
+
+/**
+ * @fn bool completerGenerateur(Generateur *gen)
+ * @brief Donne au paramètre du modèle sa valeur par défaut s'il est négatif, puis vérifie les paramètres.
+ * @param[in, out] gen Générateur (phi = 0.5 pour Mallows, alpha = 1 pour Pólya par défaut).
+ * @return false si un paramètre est hors de son domaine.
+ */
+bool completerGenerateur(Generateur *gen);
+
+/**
+ * @fn void preparerGenerateur(Generateur *gen)
+ * @brief Calcule les tables du modèle : probabilités d'insertion de Mallows, origines des bulletins de Pólya.
+ * @param[in, out] gen Générateur, dont les tables sont allouées si elles sont encore NULL.
+ *
+ * @note Les origines de Pólya dépendent de la graine : la fonction est rappelée à chaque changement de graine.
+ */
+void preparerGenerateur(Generateur *gen);
+
+/**
+ * @fn void libererGenerateur(Generateur *gen)
+ * @brief Libère les tables du modèle.
+ * @param[in, out] gen Générateur.
+ */
+void libererGenerateur(Generateur *gen);
+
+/**
+ * @fn void tirerClassement(Generateur *gen, long long votant, int *ordre, int *rangs)
+ * @brief Tire le bulletin d'un votant.
+ * @param[in] gen Générateur préparé.
+ * @param[in] votant Numéro du bulletin.
+ * @param[out] ordre Tampon de nbCandidats entiers.
+ * @param[out] rangs Rang de chaque candidat (à partir de 1), ou sa mention, -1 s'il n'est pas classé.
+ */
+void tirerClassement(Generateur *gen, long long votant, int *ordre, int *rangs);
+
+#endif
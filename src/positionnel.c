@@ -0,0 +1,264 @@
+/**
+ * @file positionnel.c
+ * @brief Méthodes positionnelles (Borda, Dowdall, anti-pluralité, Bucklin) calculées à partir d'un histogramme des rangs.
+ * @author Bibyk Bogdan
+ * @date 18 octobre 2026
+ *
+ * Ce fichier contient l'implémentation de l'histogramme des positions et des méthodes qui s'en déduisent.
+ * Les bulletins ne sont lus qu'une fois, à la construction de l'histogramme, qui trie les rangs de chacun ;
+ * chaque méthode ne lit ensuite que les C² compteurs.
+ *
+ */
+
+#ifndef POSITIONNEL_C
+#define POSITIONNEL_C
+
+#include "positionnel.h"
+
+/**
+ * @def TOLERANCE
+ * @brief Écart en dessous duquel deux totaux sont égaux : les parts d'égalité (1/3...) ne s'additionnent
+ *        pas exactement, et leur ordre d'addition ne doit pas départager deux candidats.
+ */
+#define TOLERANCE 1e-6
+
+/**
+ * @fn static void *allocPositionnelMem(size_t size)
+ * @brief Fonction d'allocation mémoire initialisée à zéro, avec arrêt du programme en cas d'échec.
+ * @param[in] size Taille à allouer.
+ * @return Pointeur vers la mémoire allouée.
+ */
+static void *allocPositionnelMem(size_t size)
+{
+    void *ptr = calloc(1, size);
+    if (ptr == NULL)
+    {
+        perror("Erreur d'allocation mémoire");
+        exit(EXIT_FAILURE);
+    }
+    return ptr;
+}
+
+/**
+ * @fn static int comparerRangs(const void *a, const void *b)
+ * @brief Comparaison de deux candidats classés (rang puis identifiant) pour qsort.
+ */
+static int comparerRangs(const void *a, const void *b)
+{
+    const int *x = a;
+    const int *y = b;
+    return x[0] != y[0] ? (x[0] > y[0]) - (x[0] < y[0]) : (x[1] > y[1]) - (x[1] < y[1]);
+}
+
+/**
+ * @fn static void ajouterBulletin(Histogramme *histo, int classes[][2], int nb_classes)
+ * @brief Répartit les positions d'un bulletin entre ses candidats classés.
+ * @param[in, out] histo Histogramme des positions.
+ * @param[in, out] classes Couples (rang, candidat) des candidats classés, triés ici.
+ * @param[in] nb_classes Nombre de candidats classés.
+ *
+ * Les positions suivent l'ordre des rangs et non leur valeur : les rangs 1, 3, 3, 7 occupent les
+ * positions 1, 2-3 et 4. Les t candidats d'un même rang se partagent les t positions qu'ils occupent,
+ * chacun pour 1/t, ce qui leur donne la moyenne des points de ces positions.
+ */
+static void ajouterBulletin(Histogramme *histo, int classes[][2], int nb_classes)
+{
+    qsort(classes, nb_classes, sizeof(classes[0]), comparerRangs);
+    int debut = 0;
+    while (debut < nb_classes)
+    {
+        int fin = debut + 1;
+        while (fin < nb_classes && classes[fin][0] == classes[debut][0])
+            fin++;
+        double part = 1.0 / (fin - debut);
+        for (int k = debut; k < fin; k++)
+            for (int p = debut; p < fin; p++)
+                HISTO(histo, classes[k][1], p) += part;
+        debut = fin;
+    }
+}
+
+/**
+ * @fn Histogramme *createHistogramme(DataFrame *df, CandidateTable *candidates)
+ * @brief Construction de l'histogramme en un seul passage sur les bulletins, en O(V·C log C).
+ * @param[in] df DataFrame contenant les bulletins.
+ * @param[in] candidates Table des candidats.
+ * @return Histogramme des positions.
+ */
+Histogramme *createHistogramme(DataFrame *df, CandidateTable *candidates)
+{
+    int nb_candidates = candidates->nb_candidates;
+    Histogramme *histo = allocPositionnelMem(sizeof(Histogramme));
+    histo->nb_candidates = nb_candidates;
+    histo->nb_ballots = df->num_rows;
+    histo->comptes = allocPositionnelMem(((size_t)nb_candidates * (nb_candidates + 1) + 1) * sizeof(double));
+
+    const int *colonnes[nb_candidates + 1];
+    for (int c = 0; c < nb_candidates; c++)
+        colonnes[c] = (int *)df->columns[candidates->columns[c]].data;
+
+    int classes[nb_candidates + 1][2];
+    for (int i = 0; i < df->num_rows; i++)
+    {
+        int nb_classes = 0;
+        for (int c = 0; c < nb_candidates; c++)
+        {
+            if (colonnes[c][i] >= 1)
+            {
+                classes[nb_classes][0] = colonnes[c][i];
+                classes[nb_classes][1] = c;
+                nb_classes++;
+            }
+            else
+                HISTO(histo, c, nb_candidates)++;
+        }
+        ajouterBulletin(histo, classes, nb_classes);
+    }
+    return histo;
+}
+
+/**
+ * @fn void deleteHistogramme(Histogramme *histo)
+ * @brief Libération de l'histogramme.
+ * @param[in] histo Histogramme.
+ */
+void deleteHistogramme(Histogramme *histo)
+{
+    free(histo->comptes);
+    free(histo);
+}
+
+/**
+ * @fn static VoteResult votePositionnel(Histogramme *histo, CandidateTable *candidates, const double *points, char *nom, FILE *log, bool debugMode)
+ * @brief Méthode positionnelle générique : chaque position rapporte un nombre de points fixé.
+ * @param[in] histo Histogramme des positions.
+ * @param[in] candidates Table des candidats.
+ * @param[in] points Points rapportés par chaque position.
+ * @param[in] nom Nom de la méthode, pour le log.
+ * @param[in] log Fichier de log.
+ * @param[in] debugMode Mode debug.
+ * @return Structure VoteResult contenant le vainqueur et ses points.
+ *
+ * @note À égalité, le candidat de plus petit identifiant l'emporte.
+ */
+static VoteResult votePositionnel(Histogramme *histo, CandidateTable *candidates, const double *points, char *nom, FILE *log, bool debugMode)
+{
+    int nb_candidates = histo->nb_candidates;
+    int vainqueur = -1;
+    double meilleur = 0;
+
+    if (journalActif(debugMode, JOURNAL_RESULTATS))
+        fprintf(log, "Résultats de la méthode %s :\n", nom);
+    for (int c = 0; c < nb_candidates; c++)
+    {
+        double score = 0;
+        for (int p = 0; p < nb_candidates; p++)
+            score += points[p] * HISTO(histo, c, p);
+        if (journalActif(debugMode, JOURNAL_DETAILS))
+            fprintf(log, "\t%s : %.2f points\n", candidates->names[c], score);
+        if (vainqueur == -1 || score > meilleur + TOLERANCE)
+        {
+            vainqueur = c;
+            meilleur = score;
+        }
+    }
+    if (journalActif(debugMode, JOURNAL_RESULTATS))
+        fprintf(log, "\n");
+    return createVoteResult(candidates, histo->nb_ballots, meilleur, vainqueur);
+}
+
+/**
+ * @fn VoteResult voteBorda(Histogramme *histo, CandidateTable *candidates, FILE *log, bool debugMode)
+ * @brief Méthode de Borda.
+ * @param[in] histo Histogramme des positions.
+ * @param[in] candidates Table des candidats.
+ * @param[in] log Fichier de log.
+ * @param[in] debugMode Mode debug.
+ * @return Structure VoteResult contenant le vainqueur et ses points.
+ */
+VoteResult voteBorda(Histogramme *histo, CandidateTable *candidates, FILE *log, bool debugMode)
+{
+    double points[histo->nb_candidates + 1];
+    for (int p = 0; p < histo->nb_candidates; p++)
+        points[p] = histo->nb_candidates - 1 - p;
+    return votePositionnel(histo, candidates, points, "de Borda", log, debugMode);
+}
+
+/**
+ * @fn VoteResult voteDowdall(Histogramme *histo, CandidateTable *candidates, FILE *log, bool debugMode)
+ * @brief Méthode de Dowdall (Borda harmonique).
+ * @param[in] histo Histogramme des positions.
+ * @param[in] candidates Table des candidats.
+ * @param[in] log Fichier de log.
+ * @param[in] debugMode Mode debug.
+ * @return Structure VoteResult contenant le vainqueur et ses points.
+ */
+VoteResult voteDowdall(Histogramme *histo, CandidateTable *candidates, FILE *log, bool debugMode)
+{
+    double points[histo->nb_candidates + 1];
+    for (int p = 0; p < histo->nb_candidates; p++)
+        points[p] = 1.0 / (p + 1);
+    return votePositionnel(histo, candidates, points, "de Dowdall", log, debugMode);
+}
+
+/**
+ * @fn VoteResult voteAntiPluralite(Histogramme *histo, CandidateTable *candidates, FILE *log, bool debugMode)
+ * @brief Méthode d'anti-pluralité : le vainqueur est le candidat le moins souvent classé dernier.
+ * @param[in] histo Histogramme des positions.
+ * @param[in] candidates Table des candidats.
+ * @param[in] log Fichier de log.
+ * @param[in] debugMode Mode debug.
+ * @return Structure VoteResult contenant le vainqueur et ses points.
+ *
+ * La position C n'est occupée que par le dernier groupe d'un bulletin qui classe tous les candidats ;
+ * sinon les non classés, qui ne reçoivent aucun point, forment ce dernier groupe.
+ */
+VoteResult voteAntiPluralite(Histogramme *histo, CandidateTable *candidates, FILE *log, bool debugMode)
+{
+    double points[histo->nb_candidates + 1];
+    for (int p = 0; p < histo->nb_candidates; p++)
+        points[p] = p < histo->nb_candidates - 1;
+    return votePositionnel(histo, candidates, points, "d'anti-pluralité", log, debugMode);
+}
+
+/**
+ * @fn VoteResult voteBucklin(Histogramme *histo, CandidateTable *candidates, FILE *log, bool debugMode, int *tour)
+ * @brief Méthode de Bucklin.
+ * @param[in] histo Histogramme des positions.
+ * @param[in] candidates Table des candidats.
+ * @param[in] log Fichier de log.
+ * @param[in] debugMode Mode debug.
+ * @param[out] tour Nombre de positions cumulées pour obtenir une majorité.
+ * @return Structure VoteResult contenant le vainqueur et ses voix cumulées.
+ */
+VoteResult voteBucklin(Histogramme *histo, CandidateTable *candidates, FILE *log, bool debugMode, int *tour)
+{
+    int nb_candidates = histo->nb_candidates;
+    double cumuls[nb_candidates + 1];
+    for (int c = 0; c < nb_candidates; c++)
+        cumuls[c] = 0;
+
+    int vainqueur = -1;
+    *tour = 0;
+    for (int p = 0; p < nb_candidates; p++)
+    {
+        // Ajout de la position p à chaque candidat, à égalité le plus petit identifiant l'emporte
+        vainqueur = -1;
+        for (int c = 0; c < nb_candidates; c++)
+        {
+            cumuls[c] += HISTO(histo, c, p);
+            if (vainqueur == -1 || cumuls[c] > cumuls[vainqueur] + TOLERANCE)
+                vainqueur = c;
+        }
+        *tour = p + 1;
+        if (journalActif(debugMode, JOURNAL_DETAILS))
+            fprintf(log, "Bucklin, tour %d : %s en tête avec %.2f voix\n", *tour, candidates->names[vainqueur], cumuls[vainqueur]);
+        if (cumuls[vainqueur] > histo->nb_ballots / 2.0 + TOLERANCE)
+            break;
+    }
+    if (journalActif(debugMode, JOURNAL_RESULTATS))
+        fprintf(log, "\n");
+    return createVoteResult(candidates, histo->nb_ballots, vainqueur == -1 ? 0 : cumuls[vainqueur], vainqueur);
+}
+
+#endif // POSITIONNEL_C
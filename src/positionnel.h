@@ -0,0 +1,110 @@
+/**
+ * @file positionnel.h
+ * @brief Méthodes positionnelles (Borda, Dowdall, anti-pluralité, Bucklin) calculées à partir d'un histogramme des rangs.
+ * @author Bibyk Bogdan
+ * @date 18 octobre 2026
+ *
+ * Ce fichier d'en-tête définit l'histogramme candidat × position, rempli en un seul passage sur les
+ * bulletins, et les méthodes de vote qui s'en déduisent chacune en O(C²). Les positions d'un bulletin
+ * suivent l'ordre de ses rangs (les rangs 1, 3, 3, 7 occupent les positions 1, 2-3 et 4), et des
+ * candidats à égalité se partagent les positions qu'ils occupent :
+ * - Borda : un candidat classé en position p (à partir de 1) reçoit C - p points ;
+ * - Dowdall : il reçoit 1/p point ;
+ * - anti-pluralité : il reçoit un point s'il n'occupe pas la dernière position du bulletin ;
+ * - Bucklin : les positions sont cumulées jusqu'à ce qu'un candidat obtienne la majorité absolue.
+ * Les candidats non classés (-1) ne reçoivent aucun point : ils ferment le bulletin, à égalité.
+ *
+ */
+
+#ifndef POSITIONNEL_H
+#define POSITIONNEL_H
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include "lecture_csv.h"
+#include "candidats.h"
+#include "utils.h"
+
+/**
+ * @struct Histogramme
+ * @brief Nombre de bulletins classant chaque candidat à chaque position.
+ */
+typedef struct Histogramme
+{
+    int nb_candidates; ///< Nombre de candidats.
+    int nb_ballots;    ///< Nombre de bulletins.
+    double *comptes;   ///< comptes[c * (nb_candidates + 1) + p] : bulletins classant c en position p + 1, la dernière case compte les non classés.
+} Histogramme;
+
+/**
+ * @def HISTO(histo, c, p)
+ * @brief Nombre de bulletins classant le candidat c en position p + 1, fractionnaire en cas d'égalité.
+ */
+#define HISTO(histo, c, p) ((histo)->comptes[(size_t)(c) * ((histo)->nb_candidates + 1) + (p)])
+
+/**
+ * @fn Histogramme *createHistogramme(DataFrame *df, CandidateTable *candidates)
+ * @brief Construction de l'histogramme en un seul passage sur les bulletins, en O(V·C log C).
+ * @param[in] df DataFrame contenant les bulletins.
+ * @param[in] candidates Table des candidats.
+ * @return Histogramme des positions.
+ */
+Histogramme *createHistogramme(DataFrame *df, CandidateTable *candidates);
+
+/**
+ * @fn void deleteHistogramme(Histogramme *histo)
+ * @brief Libération de l'histogramme.
+ * @param[in] histo Histogramme.
+ */
+void deleteHistogramme(Histogramme *histo);
+
+/**
+ * @fn VoteResult voteBorda(Histogramme *histo, CandidateTable *candidates, FILE *log, bool debugMode)
+ * @brief Méthode de Borda.
+ * @param[in] histo Histogramme des positions.
+ * @param[in] candidates Table des candidats.
+ * @param[in] log Fichier de log.
+ * @param[in] debugMode Mode debug.
+ * @return Structure VoteResult contenant le vainqueur et ses points.
+ */
+VoteResult voteBorda(Histogramme *histo, CandidateTable *candidates, FILE *log, bool debugMode);
+
+/**
+ * @fn VoteResult voteDowdall(Histogramme *histo, CandidateTable *candidates, FILE *log, bool debugMode)
+ * @brief Méthode de Dowdall (Borda harmonique).
+ * @param[in] histo Histogramme des positions.
+ * @param[in] candidates Table des candidats.
+ * @param[in] log Fichier de log.
+ * @param[in] debugMode Mode debug.
+ * @return Structure VoteResult contenant le vainqueur et ses points.
+ */
+VoteResult voteDowdall(Histogramme *histo, CandidateTable *candidates, FILE *log, bool debugMode);
+
+/**
+ * @fn VoteResult voteAntiPluralite(Histogramme *histo, CandidateTable *candidates, FILE *log, bool debugMode)
+ * @brief Méthode d'anti-pluralité : le vainqueur est le candidat le moins souvent classé dernier.
+ * @param[in] histo Histogramme des positions.
+ * @param[in] candidates Table des candidats.
+ * @param[in] log Fichier de log.
+ * @param[in] debugMode Mode debug.
+ * @return Structure VoteResult contenant le vainqueur et ses points.
+ */
+VoteResult voteAntiPluralite(Histogramme *histo, CandidateTable *candidates, FILE *log, bool debugMode);
+
+/**
+ * @fn VoteResult voteBucklin(Histogramme *histo, CandidateTable *candidates, FILE *log, bool debugMode, int *tour)
+ * @brief Méthode de Bucklin.
+ * @param[in] histo Histogramme des positions.
+ * @param[in] candidates Table des candidats.
+ * @param[in] log Fichier de log.
+ * @param[in] debugMode Mode debug.
+ * @param[out] tour Nombre de positions cumulées pour obtenir une majorité.
+ * @return Structure VoteResult contenant le vainqueur et ses voix cumulées.
+ *
+ * @note Si aucun candidat n'atteint la majorité absolue, le vainqueur est celui qui a le plus de voix
+ *       une fois toutes les positions cumulées.
+ */
+VoteResult voteBucklin(Histogramme *histo, CandidateTable *candidates, FILE *log, bool debugMode, int *tour);
+
+#endif
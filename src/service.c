@@ -0,0 +1,387 @@
+/**
+ * @file service.c
+ * @brief Service résident répondant aux demandes de dépouillement sur une socket Unix.
+ * @author Bibyk Bogdan
+ * @date 18 octobre 2026
+ *
+ * Ce fichier contient l'implémentation du mode service : cache des élections, protocole ligne à
+ * ligne et boucle d'acceptation des connexions.
+ *
+ */
+
+#ifndef SERVICE_C
+#define SERVICE_C
+
+#include <string.h>
+#include <errno.h>
+#include <limits.h>
+#include <signal.h>
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include "service.h"
+
+/**
+ * @struct ElectionCache
+ * @brief Élection gardée en mémoire, avec l'état du fichier au moment de son chargement.
+ */
+typedef struct ElectionCache
+{
+    char *chemin;                ///< Chemin du fichier.
+    bool duel;                   ///< Indique si le fichier est une matrice de duels.
+    struct timespec mtime;       ///< Date de modification du fichier au chargement.
+    off_t taille;                ///< Taille du fichier au chargement.
+    Election election;           ///< Élection et structures dérivées déjà calculées.
+    struct ElectionCache *suivant; ///< Élection suivante du cache.
+} ElectionCache;
+
+/**
+ * @struct Service
+ * @brief État partagé par les connexions.
+ */
+typedef struct Service
+{
+    ElectionCache *cache;    ///< Élections chargées.
+    OptionsScrutin *options; ///< Options du scrutin.
+    FILE *log;               ///< Fichier de log.
+    pthread_mutex_t verrou;  ///< Une demande est traitée à la fois : le cache n'est jamais modifié pendant un dépouillement.
+} Service;
+
+/**
+ * @struct Connexion
+ * @brief Connexion d'un client.
+ */
+typedef struct Connexion
+{
+    int fd;            ///< Descripteur de la connexion.
+    Service *service;  ///< Service.
+} Connexion;
+
+/// Indique qu'un signal d'arrêt a été reçu.
+static volatile sig_atomic_t arret = 0;
+
+/**
+ * @fn static void demanderArret(int signal)
+ * @brief Gestionnaire de SIGINT et SIGTERM.
+ * @param[in] signal Signal reçu.
+ */
+static void demanderArret(int signal)
+{
+    (void)signal;
+    arret = 1;
+}
+
+/**
+ * @fn static void retirerElection(Service *service, ElectionCache *entree)
+ * @brief Retire une élection du cache et libère son entrée.
+ * @param[in, out] service Service.
+ * @param[in] entree Entrée à retirer, dont l'élection est déjà fermée ou n'a pas pu être chargée.
+ */
+static void retirerElection(Service *service, ElectionCache *entree)
+{
+    ElectionCache **lien = &service->cache;
+    while (*lien != entree)
+        lien = &(*lien)->suivant;
+    *lien = entree->suivant;
+    free(entree->chemin);
+    free(entree);
+}
+
+/**
+ * @fn static ElectionCache *trouverElection(Service *service, char *chemin, bool duel, const char **erreur)
+ * @brief Cherche une élection dans le cache, en la chargeant ou la rechargeant si besoin.
+ * @param[in, out] service Service.
+ * @param[in] chemin Chemin du fichier.
+ * @param[in] duel Indique si le fichier est une matrice de duels.
+ * @param[out] erreur Message d'erreur si le fichier est illisible ou mal formé.
+ * @return Élection, NULL en cas d'erreur.
+ *
+ * @note Un fichier qui ne se charge pas n'arrête pas le service : son entrée est retirée du cache.
+ */
+static ElectionCache *trouverElection(Service *service, char *chemin, bool duel, const char **erreur)
+{
+    struct stat etat;
+    if (stat(chemin, &etat) != 0 || access(chemin, R_OK) != 0)
+    {
+        *erreur = "fichier illisible";
+        return NULL;
+    }
+
+    ElectionCache *entree = service->cache;
+    while (entree != NULL && (strcmp(entree->chemin, chemin) != 0 || entree->duel != duel))
+        entree = entree->suivant;
+
+    if (entree != NULL)
+    {
+        // Le fichier n'a pas changé : l'élection et ses structures dérivées sont réutilisées
+        if (entree->taille == etat.st_size && entree->mtime.tv_sec == etat.st_mtim.tv_sec && entree->mtime.tv_nsec == etat.st_mtim.tv_nsec)
+            return entree;
+        fermerElection(&entree->election);
+    }
+    else
+    {
+        entree = calloc(1, sizeof(ElectionCache));
+        if (entree == NULL)
+        {
+            perror("Erreur d'allocation mémoire");
+            exit(EXIT_FAILURE);
+        }
+        entree->chemin = strdup(chemin);
+        entree->duel = duel;
+        entree->suivant = service->cache;
+        service->cache = entree;
+    }
+
+    if (!chargerElection(&entree->election, chemin, duel))
+    {
+        *erreur = erreurLecture();
+        retirerElection(service, entree);
+        return NULL;
+    }
+    entree->mtime = etat.st_mtim;
+    entree->taille = etat.st_size;
+    return entree;
+}
+
+/**
+ * @fn static bool lireRangs(char *texte, int nb_candidates, int *rangs)
+ * @brief Lit les rangs d'un bulletin ajouté, séparés par des virgules.
+ * @param[in, out] texte Rangs (modifiés par le découpage).
+ * @param[in] nb_candidates Nombre de candidats attendus.
+ * @param[out] rangs Rang de chaque candidat, -1 s'il n'est pas classé.
+ * @return false si le nombre de rangs ou l'un d'eux est invalide.
+ */
+static bool lireRangs(char *texte, int nb_candidates, int *rangs)
+{
+    int nb = 0;
+    char *suite;
+    for (char *jeton = strtok_r(texte, ",", &suite); jeton != NULL; jeton = strtok_r(NULL, ",", &suite))
+    {
+        char *fin;
+        long rang = strtol(jeton, &fin, 10);
+        if (nb == nb_candidates || fin == jeton || *fin != '\0' || (rang < 1 && rang != -1) || rang > INT_MAX)
+            return false;
+        rangs[nb++] = (int)rang;
+    }
+    return nb == nb_candidates;
+}
+
+/**
+ * @fn static void ajouter(ElectionCache *entree, char *texte, FILE *out)
+ * @brief Ajoute un bulletin à une élection du cache et écrit la réponse.
+ * @param[in, out] entree Élection.
+ * @param[in, out] texte Rangs du bulletin (modifiés par le découpage).
+ * @param[out] out Réponse.
+ */
+static void ajouter(ElectionCache *entree, char *texte, FILE *out)
+{
+    Election *election = &entree->election;
+    int nb_candidates = election->candidates->nb_candidates;
+    int rangs[nb_candidates + 1];
+    if (!lireRangs(texte, nb_candidates, rangs))
+    {
+        fprintf(out, "erreur : %d rangs attendus, séparés par des virgules (-1 pour un candidat non classé)\n", nb_candidates);
+        return;
+    }
+    ajouterBulletinElection(election, rangs);
+    fprintf(out, "bulletin ajouté, %d votants\n", election->duels->nb_ballots);
+}
+
+/**
+ * @fn static void depouiller(Service *service, ElectionCache *entree, char *methode, bool duel, FILE *out)
+ * @brief Exécute les méthodes demandées sur une élection du cache et écrit la réponse.
+ * @param[in, out] service Service.
+ * @param[in, out] entree Élection.
+ * @param[in, out] methode Liste des méthodes (modifiée par le découpage).
+ * @param[in] duel Indique si l'élection est chargée depuis une matrice de duels.
+ * @param[out] out Réponse.
+ */
+static void depouiller(Service *service, ElectionCache *entree, char *methode, bool duel, FILE *out)
+{
+    // Après un ajout de bulletins, seules les méthodes Condorcet les comptent, comme pour une matrice de duels
+    bool ajoutes = entree->election.incremental != NULL;
+    char *methodes[MAX_METHODES];
+    int nbMethodes = listerMethodes(methode, duel || ajoutes, methodes);
+    for (int i = 0; i < nbMethodes; i++)
+    {
+        if (!methodeValide(methodes[i], duel || ajoutes))
+        {
+            if (ajoutes && methodeValide(methodes[i], duel))
+                fprintf(out, "erreur : méthode %s indisponible après un ajout de bulletins\n", methodes[i]);
+            else
+                fprintf(out, "erreur : méthode inconnue %s\n", methodes[i]);
+            return;
+        }
+    }
+
+    // Seules les structures dérivées qui manquent encore sont calculées
+    preparerElection(&entree->election, methodes, nbMethodes, service->options);
+    executerMethodes(&entree->election, methodes, nbMethodes, service->options, out, service->log);
+    if (service->options->debugMode)
+        fflush(service->log);
+}
+
+/**
+ * @fn static void repondre(Service *service, char *demande, FILE *out)
+ * @brief Traite une ligne de demande et écrit la réponse.
+ * @param[in, out] service Service.
+ * @param[in, out] demande Ligne de demande (modifiée par le découpage).
+ * @param[out] out Réponse.
+ */
+static void repondre(Service *service, char *demande, FILE *out)
+{
+    char *position;
+    char *mot = strtok_r(demande, " \t\r\n", &position);
+    bool ajout = mot != NULL && strcmp(mot, "ajout") == 0;
+    if (ajout)
+        mot = strtok_r(NULL, " \t\r\n", &position);
+    bool duel = mot != NULL && strcmp(mot, "-d") == 0;
+    char *chemin = duel ? strtok_r(NULL, " \t\r\n", &position) : mot;
+    char *argument = strtok_r(NULL, " \t\r\n", &position);
+    if (chemin == NULL || argument == NULL)
+    {
+        fprintf(out, "erreur : demande attendue sous la forme \"[-d] chemin méthode[,méthode...]\" ou \"ajout [-d] chemin rang,rang...\"\n\n");
+        return;
+    }
+
+    pthread_mutex_lock(&service->verrou);
+    const char *erreur = NULL;
+    ElectionCache *entree = trouverElection(service, chemin, duel, &erreur);
+    if (entree == NULL)
+        fprintf(out, "erreur : %s\n", erreur);
+    else if (ajout)
+        ajouter(entree, argument, out);
+    else
+        depouiller(service, entree, argument, duel, out);
+    pthread_mutex_unlock(&service->verrou);
+    fprintf(out, "\n");
+}
+
+/**
+ * @fn static void *servirConnexion(void *arg)
+ * @brief Lit les demandes d'une connexion jusqu'à sa fermeture ou la ligne "quit".
+ * @param[in] arg Connexion (libérée par la fonction).
+ * @return NULL.
+ */
+static void *servirConnexion(void *arg)
+{
+    Connexion *connexion = arg;
+    FILE *entree = fdopen(connexion->fd, "r");
+    FILE *sortie = entree != NULL ? fdopen(dup(connexion->fd), "w") : NULL;
+    if (sortie == NULL)
+    {
+        if (entree != NULL)
+            fclose(entree);
+        else
+            close(connexion->fd);
+        free(connexion);
+        return NULL;
+    }
+
+    char *ligne = NULL;
+    size_t taille = 0;
+    while (getline(&ligne, &taille, entree) != -1)
+    {
+        if (strncmp(ligne, "quit", 4) == 0)
+            break;
+        repondre(connexion->service, ligne, sortie);
+        if (fflush(sortie) != 0)
+            break;
+    }
+
+    free(ligne);
+    fclose(sortie);
+    fclose(entree);
+    free(connexion);
+    return NULL;
+}
+
+/**
+ * @fn int servir(char *cheminSocket, OptionsScrutin *options, FILE *log)
+ * @brief Écoute sur une socket Unix et répond aux demandes jusqu'à SIGINT ou SIGTERM.
+ * @param[in] cheminSocket Chemin de la socket (remplacée si elle existe déjà).
+ * @param[in] options Options du scrutin, communes à toutes les demandes.
+ * @param[out] log Fichier de log, utilisé seulement en mode debug.
+ * @return EXIT_SUCCESS à l'arrêt du service, EXIT_FAILURE si la socket n'a pas pu être ouverte.
+ */
+int servir(char *cheminSocket, OptionsScrutin *options, FILE *log)
+{
+    struct sockaddr_un adresse = {0};
+    adresse.sun_family = AF_UNIX;
+    if (strlen(cheminSocket) >= sizeof(adresse.sun_path))
+    {
+        fprintf(stderr, "Chemin de socket trop long : %s\n", cheminSocket);
+        return EXIT_FAILURE;
+    }
+    strcpy(adresse.sun_path, cheminSocket);
+
+    int ecoute = socket(AF_UNIX, SOCK_STREAM, 0);
+    if (ecoute == -1)
+    {
+        perror("socket");
+        return EXIT_FAILURE;
+    }
+    unlink(cheminSocket);
+    if (bind(ecoute, (struct sockaddr *)&adresse, sizeof(adresse)) == -1 || listen(ecoute, 16) == -1)
+    {
+        perror("bind");
+        close(ecoute);
+        return EXIT_FAILURE;
+    }
+
+    // Sans SA_RESTART, accept() est interrompu par le signal d'arrêt
+    struct sigaction action = {0};
+    action.sa_handler = demanderArret;
+    sigemptyset(&action.sa_mask);
+    sigaction(SIGINT, &action, NULL);
+    sigaction(SIGTERM, &action, NULL);
+    signal(SIGPIPE, SIG_IGN);
+
+    Service service = {NULL, options, log, PTHREAD_MUTEX_INITIALIZER};
+    pthread_attr_t attributs;
+    pthread_attr_init(&attributs);
+    pthread_attr_setdetachstate(&attributs, PTHREAD_CREATE_DETACHED);
+
+    while (!arret)
+    {
+        int fd = accept(ecoute, NULL, NULL);
+        if (fd == -1)
+        {
+            if (errno != EINTR)
+                perror("accept");
+            continue;
+        }
+        Connexion *connexion = malloc(sizeof(Connexion));
+        if (connexion == NULL)
+        {
+            perror("Erreur d'allocation mémoire");
+            exit(EXIT_FAILURE);
+        }
+        *connexion = (Connexion){fd, &service};
+        pthread_t thread;
+        if (pthread_create(&thread, &attributs, servirConnexion, connexion) != 0)
+        {
+            close(fd);
+            free(connexion);
+        }
+    }
+
+    // Les connexions encore ouvertes sont abandonnées : le cache n'est libéré qu'une fois le verrou obtenu
+    close(ecoute);
+    unlink(cheminSocket);
+    pthread_attr_destroy(&attributs);
+    pthread_mutex_lock(&service.verrou);
+    while (service.cache != NULL)
+    {
+        ElectionCache *suivant = service.cache->suivant;
+        fermerElection(&service.cache->election);
+        free(service.cache->chemin);
+        free(service.cache);
+        service.cache = suivant;
+    }
+    return EXIT_SUCCESS;
+}
+
+#endif // SERVICE_C
@@ -0,0 +1,44 @@
+/**
+ * @file service.h
+ * @brief Service résident répondant aux demandes de dépouillement sur une socket Unix.
+ * @author Bibyk Bogdan
+ * @date 18 octobre 2026
+ *
+ * Ce fichier d'en-tête définit le mode service. Les élections déjà chargées restent en mémoire avec
+ * leurs structures dérivées (matrice des duels, histogramme des positions...) ; un fichier n'est
+ * relu que si sa date de modification ou sa taille a changé.
+ *
+ * Protocole, une demande par ligne :
+ * - "[-d] chemin méthode[,méthode...]" dépouille l'élection ;
+ * - "ajout [-d] chemin rang,rang..." ajoute un bulletin (un rang par candidat, -1 s'il n'est pas classé).
+ *   Le bulletin est compté par le moteur incrémental Condorcet (condorcet_incremental.h) : chaque ajout
+ *   coûte O(C²) au plus, et les dépouillements suivants ne recalculent que ce qu'il a pu changer.
+ *   Seules cm, cp et cs sont ensuite disponibles sur cette élection. Les bulletins ajoutés ne sont gardés
+ *   qu'en mémoire : ils sont perdus si le fichier change, puisque l'élection est alors relue.
+ * La réponse est faite des lignes de résultats (ou d'une ligne "erreur : ..."), suivies d'une ligne vide.
+ * La ligne "quit" ferme la connexion.
+ *
+ */
+
+#ifndef SERVICE_H
+#define SERVICE_H
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include "execution.h"
+
+/**
+ * @fn int servir(char *cheminSocket, OptionsScrutin *options, FILE *log)
+ * @brief Écoute sur une socket Unix et répond aux demandes jusqu'à SIGINT ou SIGTERM.
+ * @param[in] cheminSocket Chemin de la socket (remplacée si elle existe déjà).
+ * @param[in] options Options du scrutin, communes à toutes les demandes.
+ * @param[out] log Fichier de log, utilisé seulement en mode debug.
+ * @return EXIT_SUCCESS à l'arrêt du service, EXIT_FAILURE si la socket n'a pas pu être ouverte.
+ *
+ * @note Chaque connexion est servie par son propre thread. Les demandes sont traitées une à la fois,
+ *       les méthodes d'une même demande s'exécutant en parallèle.
+ */
+int servir(char *cheminSocket, OptionsScrutin *options, FILE *log);
+
+#endif
@@ -0,0 +1,355 @@
+/**
+ * @file simulation.c
+ * @brief Simulation de Monte-Carlo : comparaison des méthodes sur des élections aléatoires (option --simulate).
+ * @author Bibyk Bogdan
+ * @date 18 octobre 2026
+ *
+ * Ce fichier contient l'implémentation du mode simulation. Chaque thread possède un DataFrame et une
+ * table des candidats, alloués une seule fois : les bulletins de chaque élection y sont tirés en
+ * place, puis les structures dérivées sont calculées et libérées comme pour un fichier. Chaque thread
+ * tient son propre bilan, additionné aux autres à la fin.
+ *
+ */
+
+#ifndef SIMULATION_C
+#define SIMULATION_C
+
+#include <string.h>
+#include <limits.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include "simulation.h"
+
+/**
+ * @def MAX_LIBELLES
+ * @brief Nombre maximal de résultats comparés : une méthode peut en donner plusieurs (cm, cmv, cmo).
+ */
+#define MAX_LIBELLES (MAX_METHODES + 2)
+
+/**
+ * @def ELECTIONS_PAR_LOT
+ * @brief Nombre d'élections réservées à la fois par un thread.
+ */
+#define ELECTIONS_PAR_LOT 64
+
+/**
+ * @struct Bilan
+ * @brief Compteurs d'un thread, puis de toute la simulation.
+ */
+typedef struct Bilan
+{
+    long long elections;                              ///< Élections simulées.
+    long long avecCondorcet;                          ///< Élections avec un vainqueur de Condorcet.
+    long long condorcet[MAX_LIBELLES];                ///< Élections où la méthode élit le vainqueur de Condorcet.
+    long long accords[MAX_LIBELLES][MAX_LIBELLES];    ///< Élections où deux méthodes élisent le même candidat (l <= k).
+} Bilan;
+
+/**
+ * @struct Simulation
+ * @brief Données partagées par les threads.
+ */
+typedef struct Simulation
+{
+    ParametresSimulation *params;  ///< Paramètres.
+    char **methodes;               ///< Méthodes exécutées.
+    int nbMethodes;                ///< Nombre de méthodes.
+    OptionsScrutin options;        ///< Options du scrutin, sans log et à un siège.
+    Generateur modele;             ///< Modèle préparé, partagé en lecture seule.
+    char *libelles[MAX_LIBELLES];  ///< Libellés des résultats, fixés par la première élection.
+    int nbLibelles;                ///< Nombre de libellés.
+    _Atomic long long suivante;    ///< Prochaine élection à réserver.
+} Simulation;
+
+/**
+ * @struct Travailleur
+ * @brief État d'un thread de simulation.
+ */
+typedef struct Travailleur
+{
+    Simulation *sim;             ///< Simulation.
+    DataFrame *df;               ///< Bulletins de l'élection en cours.
+    CandidateTable *candidates;  ///< Table des candidats.
+    Generateur gen;              ///< Générateur, dont la graine change à chaque élection.
+    Bilan bilan;                 ///< Compteurs du thread.
+    pthread_t thread;            ///< Thread.
+} Travailleur;
+
+/**
+ * @fn static void *allouerSimulation(size_t taille)
+ * @brief Allocation mémoire avec arrêt du programme en cas d'échec.
+ * @param[in] taille Taille à allouer.
+ * @return Pointeur vers la mémoire allouée.
+ */
+static void *allouerSimulation(size_t taille)
+{
+    void *ptr = malloc(taille);
+    if (ptr == NULL)
+    {
+        perror("Erreur d'allocation mémoire");
+        exit(EXIT_FAILURE);
+    }
+    return ptr;
+}
+
+/**
+ * @fn static DataFrame *creerBulletinsSimules(int nbCandidats, int nbVotants)
+ * @brief Crée un DataFrame de bulletins au format lu dans un fichier : une colonne d'index, puis une colonne par candidat.
+ * @param[in] nbCandidats Nombre de candidats.
+ * @param[in] nbVotants Nombre de bulletins.
+ * @return DataFrame, à libérer avec freeDataFrame.
+ */
+static DataFrame *creerBulletinsSimules(int nbCandidats, int nbVotants)
+{
+    DataFrame *df = allouerSimulation(sizeof(DataFrame));
+    *df = (DataFrame){.index_name = NULL, .num_columns = nbCandidats + 1, .num_rows = nbVotants, .delimiter = ','};
+    df->columns = allouerSimulation((nbCandidats + 1) * sizeof(Column));
+    for (int j = 0; j <= nbCandidats; j++)
+    {
+        char nom[32];
+        if (j == 0)
+            snprintf(nom, sizeof(nom), "Votant");
+        else
+            snprintf(nom, sizeof(nom), "Candidat %d", j);
+        df->columns[j].name = strcpy(allouerSimulation(strlen(nom) + 1), nom);
+        df->columns[j].ctype = INT;
+        df->columns[j].data = allouerSimulation((size_t)nbVotants * sizeof(int));
+    }
+    for (int v = 0; v < nbVotants; v++)
+        ((int *)df->columns[0].data)[v] = v + 1;
+    return df;
+}
+
+/**
+ * @fn static int trouverLibelle(Simulation *sim, char *libelle, bool ajouter)
+ * @brief Indice d'un libellé de résultat.
+ * @param[in, out] sim Simulation.
+ * @param[in] libelle Libellé.
+ * @param[in] ajouter Ajout du libellé s'il est inconnu (première élection seulement).
+ * @return Indice, -1 si le libellé est inconnu et n'est pas ajouté.
+ */
+static int trouverLibelle(Simulation *sim, char *libelle, bool ajouter)
+{
+    for (int l = 0; l < sim->nbLibelles; l++)
+    {
+        if (strcmp(sim->libelles[l], libelle) == 0)
+            return l;
+    }
+    if (!ajouter || sim->nbLibelles == MAX_LIBELLES)
+        return -1;
+    sim->libelles[sim->nbLibelles] = libelle;
+    return sim->nbLibelles++;
+}
+
+/**
+ * @fn static void simulerElection(Travailleur *t, long long numero, bool decouverte)
+ * @brief Tire une élection, exécute les méthodes et met à jour le bilan du thread.
+ * @param[in, out] t Thread.
+ * @param[in] numero Numéro de l'élection, qui détermine ses bulletins.
+ * @param[in] decouverte Enregistrement des libellés des résultats (première élection, avant le lancement des threads).
+ */
+static void simulerElection(Travailleur *t, long long numero, bool decouverte)
+{
+    Simulation *sim = t->sim;
+    Generateur *gen = &t->gen;
+    int c = gen->nbCandidats;
+    int ordre[c];
+    int rangs[c];
+
+    // Les bulletins sont tirés en place, colonne par candidat comme à la lecture d'un fichier
+    gen->graine = fluxAleatoire(sim->modele.graine, 5, numero);
+    preparerGenerateur(gen);
+    for (long long v = 0; v < gen->nbVotants; v++)
+    {
+        tirerClassement(gen, v, ordre, rangs);
+        for (int a = 0; a < c; a++)
+            ((int *)t->df->columns[a + 1].data)[v] = rangs[a];
+    }
+
+    // La matrice des duels donne le vainqueur de Condorcet, même sans méthode Condorcet demandée
+    Election election = {0};
+    election.df = t->df;
+    election.candidates = t->candidates;
+    preparerElection(&election, sim->methodes, sim->nbMethodes, &sim->options);
+    if (election.duels == NULL)
+        election.duels = createDuelMatrixFromDf(t->df, t->candidates, false);
+    int vainqueurCondorcet = findCondorcetWinner(election.duels);
+
+    // Le dernier résultat d'un libellé est son vainqueur : le second tour pour uni2
+    int vainqueurs[MAX_LIBELLES];
+    for (int l = 0; l < MAX_LIBELLES; l++)
+        vainqueurs[l] = -1;
+    ResultatMethode resultats[nbResultatsMax(&sim->options)];
+    for (int m = 0; m < sim->nbMethodes; m++)
+    {
+        int nb = calculerMethode(sim->methodes[m], &election, &sim->options, NULL, resultats);
+        for (int r = 0; r < nb; r++)
+        {
+            int l = trouverLibelle(sim, resultats[r].libelle, decouverte);
+            if (l >= 0)
+                vainqueurs[l] = resultats[r].resultat.winner;
+        }
+    }
+    libererElection(&election);
+
+    Bilan *bilan = &t->bilan;
+    bilan->elections++;
+    if (vainqueurCondorcet >= 0)
+    {
+        bilan->avecCondorcet++;
+        for (int l = 0; l < sim->nbLibelles; l++)
+            bilan->condorcet[l] += vainqueurs[l] == vainqueurCondorcet;
+    }
+    for (int l = 0; l < sim->nbLibelles; l++)
+    {
+        if (vainqueurs[l] < 0)
+            continue;
+        for (int k = l; k < sim->nbLibelles; k++)
+            bilan->accords[l][k] += vainqueurs[k] == vainqueurs[l];
+    }
+}
+
+/**
+ * @fn static void *travailler(void *arg)
+ * @brief Point d'entrée d'un thread : réserve des lots d'élections jusqu'à épuisement.
+ * @param[in, out] arg Thread.
+ * @return NULL.
+ */
+static void *travailler(void *arg)
+{
+    Travailleur *t = arg;
+    Simulation *sim = t->sim;
+    long long nbElections = sim->params->nbElections;
+    while (true)
+    {
+        long long debut = atomic_fetch_add_explicit(&sim->suivante, ELECTIONS_PAR_LOT, memory_order_relaxed);
+        if (debut >= nbElections)
+            break;
+        long long fin = debut + ELECTIONS_PAR_LOT < nbElections ? debut + ELECTIONS_PAR_LOT : nbElections;
+        for (long long e = debut; e < fin; e++)
+            simulerElection(t, e, false);
+    }
+    return NULL;
+}
+
+/**
+ * @fn static void afficherBilan(Simulation *sim, Bilan *bilan, FILE *out)
+ * @brief Écrit la fréquence du paradoxe de Condorcet, l'efficacité de Condorcet et les taux d'accord.
+ * @param[in] sim Simulation.
+ * @param[in] bilan Bilan de toute la simulation.
+ * @param[out] out Fichier de sortie.
+ */
+static void afficherBilan(Simulation *sim, Bilan *bilan, FILE *out)
+{
+    static const char *nomsModeles[] = {"ic", "mallows", "polya"};
+    Generateur *modele = &sim->modele;
+    int nb = sim->nbLibelles;
+    double elections = (double)bilan->elections;
+
+    fprintf(out, "Simulation : %lld élections, modèle %s", bilan->elections, nomsModeles[modele->modele]);
+    if (modele->modele != IMPARTIAL)
+        fprintf(out, " (%s = %g)", modele->modele == MALLOWS ? "phi" : "alpha", modele->parametre);
+    fprintf(out, ", %d candidats, %lld votants, graine %llu\n", modele->nbCandidats, modele->nbVotants, (unsigned long long)modele->graine);
+    fprintf(out, "Paradoxe de Condorcet : %.2f %% des élections (%lld sans vainqueur de Condorcet)\n",
+            100.0 * (bilan->elections - bilan->avecCondorcet) / elections, bilan->elections - bilan->avecCondorcet);
+
+    fprintf(out, "\nEfficacité de Condorcet (part des %lld élections avec un vainqueur de Condorcet où il est élu) :\n", bilan->avecCondorcet);
+    for (int l = 0; l < nb; l++)
+    {
+        if (bilan->avecCondorcet > 0)
+            fprintf(out, "  %-8s %7.2f %%\n", sim->libelles[l], 100.0 * bilan->condorcet[l] / bilan->avecCondorcet);
+        else
+            fprintf(out, "  %-8s %7s\n", sim->libelles[l], "-");
+    }
+
+    // La diagonale est la part des élections où la méthode désigne un vainqueur
+    fprintf(out, "\nTaux d'accord (%% des élections où les deux méthodes élisent le même candidat) :\n");
+    fprintf(out, "  %-8s", "");
+    for (int k = 0; k < nb; k++)
+        fprintf(out, " %8s", sim->libelles[k]);
+    fprintf(out, "\n");
+    for (int l = 0; l < nb; l++)
+    {
+        fprintf(out, "  %-8s", sim->libelles[l]);
+        for (int k = 0; k < nb; k++)
+            fprintf(out, " %8.1f", 100.0 * (l <= k ? bilan->accords[l][k] : bilan->accords[k][l]) / elections);
+        fprintf(out, "\n");
+    }
+}
+
+/**
+ * @fn int simuler(ParametresSimulation *params, char **methodes, int nbMethodes, OptionsScrutin *options, FILE *out)
+ * @brief Tire les élections, exécute les méthodes sur chacune et écrit le bilan.
+ * @param[in] params Paramètres de la simulation.
+ * @param[in] methodes Noms des méthodes (méthodes sur bulletins).
+ * @param[in] nbMethodes Nombre de méthodes.
+ * @param[in] options Options du scrutin (le vote unique transférable est réduit à un siège, le log est ignoré).
+ * @param[out] out Fichier du bilan.
+ * @return EXIT_SUCCESS, ou EXIT_FAILURE si les paramètres du modèle sont invalides.
+ */
+int simuler(ParametresSimulation *params, char **methodes, int nbMethodes, OptionsScrutin *options, FILE *out)
+{
+    Simulation sim = {.params = params, .methodes = methodes, .nbMethodes = nbMethodes, .options = *options, .modele = params->modele};
+    if (params->nbElections < 1 || params->modele.nbVotants > INT_MAX || !completerGenerateur(&sim.modele))
+    {
+        fprintf(stderr, "Paramètres de simulation invalides\n");
+        return EXIT_FAILURE;
+    }
+    // Une élection ne compare que des vainqueurs uniques, et son log serait aussi long que la simulation
+    sim.options.debugMode = false;
+    sim.options.nbSieges = 1;
+    if (sim.modele.modele == MALLOWS)
+        preparerGenerateur(&sim.modele);
+
+    int nbThreads = params->nbThreads;
+    if (nbThreads > params->nbElections)
+        nbThreads = (int)params->nbElections;
+    Travailleur travailleurs[nbThreads];
+    bool lance[nbThreads];
+    for (int i = 0; i < nbThreads; i++)
+    {
+        Travailleur *t = &travailleurs[i];
+        *t = (Travailleur){.sim = &sim, .gen = sim.modele};
+        t->gen.racines = NULL;
+        t->df = creerBulletinsSimules(sim.modele.nbCandidats, (int)sim.modele.nbVotants);
+        t->candidates = createCandidateTable(t->df, false);
+    }
+
+    // La première élection fixe l'ordre des libellés, ensuite seulement lus par les threads
+    simulerElection(&travailleurs[0], 0, true);
+    atomic_store(&sim.suivante, 1);
+    lance[0] = false;
+    for (int i = 1; i < nbThreads; i++)
+        lance[i] = pthread_create(&travailleurs[i].thread, NULL, travailler, &travailleurs[i]) == 0;
+    // Le thread courant est le premier travailleur : sans autre thread, il simule toutes les élections
+    travailler(&travailleurs[0]);
+
+    Bilan *total = allouerSimulation(sizeof(Bilan));
+    memset(total, 0, sizeof(Bilan));
+    for (int i = 0; i < nbThreads; i++)
+    {
+        Travailleur *t = &travailleurs[i];
+        if (lance[i])
+            pthread_join(t->thread, NULL);
+        total->elections += t->bilan.elections;
+        total->avecCondorcet += t->bilan.avecCondorcet;
+        for (int l = 0; l < sim.nbLibelles; l++)
+        {
+            total->condorcet[l] += t->bilan.condorcet[l];
+            for (int k = l; k < sim.nbLibelles; k++)
+                total->accords[l][k] += t->bilan.accords[l][k];
+        }
+    }
+    afficherBilan(&sim, total, out);
+
+    for (int i = 0; i < nbThreads; i++)
+    {
+        deleteCandidateTable(travailleurs[i].candidates);
+        freeDataFrame(travailleurs[i].df);
+        free(travailleurs[i].gen.racines);
+    }
+    libererGenerateur(&sim.modele);
+    free(total);
+    return EXIT_SUCCESS;
+}
+
+#endif // SIMULATION_C
@@ -0,0 +1,52 @@
+/**
+ * @file simulation.h
+ * @brief Simulation de Monte-Carlo : comparaison des méthodes sur des élections aléatoires (option --simulate).
+ * @author Bibyk Bogdan
+ * @date 18 octobre 2026
+ *
+ * Ce fichier d'en-tête définit le mode simulation. Les élections sont tirées en mémoire selon un
+ * modèle de préférences (voir modeles.h), sans passer par un fichier, puis chaque méthode demandée
+ * est exécutée sur chacune d'elles. Le bilan donne :
+ * - la fréquence du paradoxe de Condorcet (élections sans vainqueur de Condorcet) ;
+ * - l'efficacité de Condorcet de chaque méthode (part des élections avec un vainqueur de Condorcet
+ *   où la méthode l'élit) ;
+ * - le taux d'accord de chaque paire de méthodes (part des élections où elles élisent le même candidat).
+ *
+ * Les élections sont réparties entre les threads par lots ; chacune est tirée à partir de la graine
+ * et de son numéro, si bien que le bilan ne dépend pas du nombre de threads.
+ *
+ */
+
+#ifndef SIMULATION_H
+#define SIMULATION_H
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include "modeles.h"
+#include "execution.h"
+
+/**
+ * @struct ParametresSimulation
+ * @brief Paramètres d'une simulation.
+ */
+typedef struct ParametresSimulation
+{
+    long long nbElections; ///< Nombre d'élections tirées.
+    Generateur modele;     ///< Modèle, nombre de candidats et de votants, graine de la simulation.
+    int nbThreads;         ///< Nombre de threads.
+} ParametresSimulation;
+
+/**
+ * @fn int simuler(ParametresSimulation *params, char **methodes, int nbMethodes, OptionsScrutin *options, FILE *out)
+ * @brief Tire les élections, exécute les méthodes sur chacune et écrit le bilan.
+ * @param[in] params Paramètres de la simulation.
+ * @param[in] methodes Noms des méthodes (méthodes sur bulletins).
+ * @param[in] nbMethodes Nombre de méthodes.
+ * @param[in] options Options du scrutin (le vote unique transférable est réduit à un siège, le log est ignoré).
+ * @param[out] out Fichier du bilan.
+ * @return EXIT_SUCCESS, ou EXIT_FAILURE si les paramètres du modèle sont invalides.
+ */
+int simuler(ParametresSimulation *params, char **methodes, int nbMethodes, OptionsScrutin *options, FILE *out);
+
+#endif
@@ -0,0 +1,164 @@
+/**
+ * @file smith.c
+ * @brief Ensembles de Smith et de Schwartz calculés à partir de la matrice des duels.
+ * @author Bibyk Bogdan
+ * @date 18 octobre 2026
+ *
+ * Ce fichier contient l'implémentation du calcul des ensembles de Smith et de Schwartz.
+ * Les composantes fortement connexes sont obtenues par l'algorithme de Tarjan, les arcs
+ * étant lus directement dans la matrice des duels.
+ *
+ */
+
+#ifndef SMITH_C
+#define SMITH_C
+
+#include "smith.h"
+
+/**
+ * @struct Tarjan
+ * @brief État de l'algorithme de Tarjan.
+ */
+typedef struct Tarjan
+{
+    DuelMatrix *duels;  ///< Matrice des duels.
+    bool egalites;      ///< Vrai si une égalité donne un arc dans les deux sens.
+    int *indices;       ///< Ordre de découverte de chaque candidat, -1 si non visité.
+    int *bas;           ///< Plus petit indice atteignable depuis le candidat.
+    int *composantes;   ///< Composante de chaque candidat.
+    int *pile;          ///< Pile des candidats en cours de traitement.
+    bool *empile;       ///< Vrai si le candidat est dans la pile.
+    int sommet;         ///< Nombre de candidats dans la pile.
+    int compteur;       ///< Prochain indice de découverte.
+    int nb_composantes; ///< Nombre de composantes trouvées.
+} Tarjan;
+
+/**
+ * @fn static bool arc(Tarjan *t, int i, int j)
+ * @brief Indique si le graphe des duels contient l'arc i -> j.
+ * @param[in] t État de l'algorithme.
+ * @param[in] i Candidat de départ.
+ * @param[in] j Candidat d'arrivée.
+ * @return Vrai si i bat j (ou fait égalité avec j si les égalités comptent).
+ */
+static bool arc(Tarjan *t, int i, int j)
+{
+    int marge = DUEL_MARGIN(t->duels, i, j);
+    return i != j && (marge > 0 || (t->egalites && marge == 0));
+}
+
+/**
+ * @fn static void visiter(Tarjan *t, int v)
+ * @brief Parcours en profondeur de Tarjan depuis un candidat.
+ * @param[in, out] t État de l'algorithme.
+ * @param[in] v Candidat visité.
+ */
+static void visiter(Tarjan *t, int v)
+{
+    int nb_candidates = t->duels->nb_candidates;
+    t->indices[v] = t->bas[v] = t->compteur++;
+    t->pile[t->sommet++] = v;
+    t->empile[v] = true;
+
+    for (int w = 0; w < nb_candidates; w++)
+    {
+        if (!arc(t, v, w))
+            continue;
+        if (t->indices[w] == -1)
+        {
+            visiter(t, w);
+            t->bas[v] = t->bas[w] < t->bas[v] ? t->bas[w] : t->bas[v];
+        }
+        else if (t->empile[w] && t->indices[w] < t->bas[v])
+            t->bas[v] = t->indices[w];
+    }
+
+    // v est la racine d'une composante : on la dépile entièrement
+    if (t->bas[v] == t->indices[v])
+    {
+        int w;
+        do
+        {
+            w = t->pile[--t->sommet];
+            t->empile[w] = false;
+            t->composantes[w] = t->nb_composantes;
+        } while (w != v);
+        t->nb_composantes++;
+    }
+}
+
+/**
+ * @fn static int composantesSources(DuelMatrix *duels, bool egalites, int *membres)
+ * @brief Union des composantes fortement connexes sans arc entrant depuis une autre composante.
+ * @param[in] duels Matrice des duels.
+ * @param[in] egalites Vrai si une égalité donne un arc dans les deux sens.
+ * @param[out] membres Identifiants des membres, par ordre croissant.
+ * @return Nombre de membres.
+ */
+static int composantesSources(DuelMatrix *duels, bool egalites, int *membres)
+{
+    int nb_candidates = duels->nb_candidates;
+    int indices[nb_candidates + 1];
+    int bas[nb_candidates + 1];
+    int composantes[nb_candidates + 1];
+    int pile[nb_candidates + 1];
+    bool empile[nb_candidates + 1];
+    bool battue[nb_candidates + 1];
+
+    Tarjan t = {duels, egalites, indices, bas, composantes, pile, empile, 0, 0, 0};
+    for (int v = 0; v < nb_candidates; v++)
+    {
+        indices[v] = -1;
+        empile[v] = false;
+        battue[v] = false;
+    }
+    for (int v = 0; v < nb_candidates; v++)
+    {
+        if (indices[v] == -1)
+            visiter(&t, v);
+    }
+
+    // Une composante est battue si un arc y entre depuis une autre composante
+    for (int i = 0; i < nb_candidates; i++)
+    {
+        for (int j = 0; j < nb_candidates; j++)
+        {
+            if (composantes[i] != composantes[j] && arc(&t, i, j))
+                battue[composantes[j]] = true;
+        }
+    }
+
+    int nb_membres = 0;
+    for (int v = 0; v < nb_candidates; v++)
+    {
+        if (!battue[composantes[v]])
+            membres[nb_membres++] = v;
+    }
+    return nb_membres;
+}
+
+/**
+ * @fn int ensembleSmith(DuelMatrix *duels, int *membres)
+ * @brief Calcul de l'ensemble de Smith.
+ * @param[in] duels Matrice des duels.
+ * @param[out] membres Identifiants des membres, par ordre croissant.
+ * @return Nombre de membres.
+ */
+int ensembleSmith(DuelMatrix *duels, int *membres)
+{
+    return composantesSources(duels, true, membres);
+}
+
+/**
+ * @fn int ensembleSchwartz(DuelMatrix *duels, int *membres)
+ * @brief Calcul de l'ensemble de Schwartz.
+ * @param[in] duels Matrice des duels.
+ * @param[out] membres Identifiants des membres, par ordre croissant.
+ * @return Nombre de membres.
+ */
+int ensembleSchwartz(DuelMatrix *duels, int *membres)
+{
+    return composantesSources(duels, false, membres);
+}
+
+#endif // SMITH_C
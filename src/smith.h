@@ -0,0 +1,44 @@
+/**
+ * @file smith.h
+ * @brief Ensembles de Smith et de Schwartz calculés à partir de la matrice des duels.
+ * @author Bibyk Bogdan
+ * @date 18 octobre 2026
+ *
+ * Ce fichier d'en-tête définit le calcul des ensembles de Smith et de Schwartz par
+ * condensation du graphe des duels en composantes fortement connexes, en O(C²) :
+ * - l'ensemble de Smith est la composante source du graphe « bat ou fait égalité avec » ;
+ * - l'ensemble de Schwartz est l'union des composantes sources du graphe « bat strictement ».
+ * Schulze et la méthode des paires désignent toujours un vainqueur de l'ensemble de Smith,
+ * ils peuvent donc ne travailler que sur ce sous-ensemble.
+ *
+ */
+
+#ifndef SMITH_H
+#define SMITH_H
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include "duels.h"
+
+/**
+ * @fn int ensembleSmith(DuelMatrix *duels, int *membres)
+ * @brief Calcul de l'ensemble de Smith : plus petit ensemble dont chaque membre bat tous les autres candidats.
+ * @param[in] duels Matrice des duels.
+ * @param[out] membres Identifiants des membres, par ordre croissant (au moins nb_candidates cases).
+ * @return Nombre de membres.
+ */
+int ensembleSmith(DuelMatrix *duels, int *membres);
+
+/**
+ * @fn int ensembleSchwartz(DuelMatrix *duels, int *membres)
+ * @brief Calcul de l'ensemble de Schwartz : union des plus petits ensembles non battus de l'extérieur.
+ * @param[in] duels Matrice des duels.
+ * @param[out] membres Identifiants des membres, par ordre croissant (au moins nb_candidates cases).
+ * @return Nombre de membres.
+ *
+ * @note L'ensemble de Schwartz est toujours inclus dans l'ensemble de Smith, il en diffère en cas d'égalité.
+ */
+int ensembleSchwartz(DuelMatrix *duels, int *membres);
+
+#endif
@@ -0,0 +1,288 @@
+/**
+ * @file statistiques.c
+ * @brief Mesure du temps passé dans chaque phase et compteurs d'activité (option --stats).
+ * @author Bibyk Bogdan
+ * @date 18 octobre 2026
+ *
+ * Ce fichier contient l'implémentation des chronomètres et des compteurs. Les phases sont peu
+ * nombreuses et enregistrées une fois par étape : une table protégée par un mutex suffit. Les
+ * compteurs sont atomiques, les méthodes s'exécutant en parallèle. Les événements matériels sont
+ * relevés dans le thread qui exécute la phase, au début et à la fin de celle-ci.
+ *
+ */
+
+#ifndef STATISTIQUES_C
+#define STATISTIQUES_C
+
+#include <string.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include "statistiques.h"
+#include "trace.h"
+
+/**
+ * @def MAX_PHASES
+ * @brief Nombre maximal de phases distinctes.
+ */
+#define MAX_PHASES 32
+
+/**
+ * @def LONGUEUR_PHASE
+ * @brief Longueur maximale du nom d'une phase.
+ */
+#define LONGUEUR_PHASE 32
+
+/**
+ * @struct Phase
+ * @brief Durée cumulée d'une phase.
+ */
+typedef struct Phase
+{
+    char nom[LONGUEUR_PHASE]; ///< Nom de la phase.
+    uint64_t total;           ///< Durée cumulée en nanosecondes.
+    uint64_t nombre;          ///< Nombre de mesures.
+    uint64_t materiel[NB_EVENEMENTS]; ///< Événements matériels cumulés.
+    uint64_t alloue;          ///< Octets alloués pendant la phase.
+    int64_t retenu;           ///< Octets alloués et non libérés pendant la phase.
+    uint64_t allocations;     ///< Nombre d'allocations.
+    long picRss;              ///< Pic de mémoire résidente du processus à la fin de la phase, en kilo-octets.
+} Phase;
+
+bool statsActives = false;
+
+static Phase phases[MAX_PHASES];
+static int nbPhases = 0;
+static pthread_mutex_t verrouPhases = PTHREAD_MUTEX_INITIALIZER;
+static _Atomic uint64_t compteurs[NB_COMPTEURS];
+static uint64_t debutGlobal;
+static bool materielActif = false;
+static bool memoireActive = false;
+
+/// Noms des compteurs, dans l'ordre de l'énumération.
+static const char *nomsCompteurs[NB_COMPTEURS] = {"lignes", "octets", "fichiers", "paires", "chemins"};
+
+/// Noms des événements matériels en JSON, dans l'ordre de l'énumération.
+static const char *nomsEvenements[NB_EVENEMENTS] = {"cycles", "instructions", "defauts_cache", "defauts_branche"};
+
+/**
+ * @fn void activerStatistiques(bool materiel)
+ * @brief Active la collecte et démarre le chronomètre global.
+ * @param[in] materiel Relevé des compteurs matériels (option --perf), signalés sur stderr s'ils sont indisponibles.
+ */
+void activerStatistiques(bool materiel)
+{
+    // Sans aucun compteur disponible, seul le temps est mesuré
+    if (materiel)
+        materielActif = activerCompteursMateriels(stderr) > 0;
+    memoireActive = activerSuiviMemoire();
+    statsActives = true;
+    debutGlobal = instantNs();
+}
+
+/**
+ * @fn Instant instantCourant(void)
+ * @brief Relève l'horloge monotone et les compteurs matériels du thread appelant.
+ * @return Instant courant.
+ */
+Instant instantCourant(void)
+{
+    Instant instant;
+    if (materielActif)
+        lireCompteursMateriels(instant.materiel);
+    else
+        memset(instant.materiel, 0, sizeof(instant.materiel));
+    instant.memoire = lireMemoireThread();
+    instant.ns = instantNs();
+    return instant;
+}
+
+/**
+ * @fn void enregistrerPhase(const char *phase, const Instant *debut)
+ * @brief Cumule dans une phase, créée à sa première mesure, ce qui s'est écoulé depuis debut.
+ * @param[in] phase Nom de la phase (copié).
+ * @param[in] debut Instant relevé au début de la phase, dans le même thread.
+ */
+void enregistrerPhase(const char *phase, const Instant *debut)
+{
+    Instant fin = instantCourant();
+    if (traceActive)
+        tracerPhase(phase, debut->ns, fin.ns);
+    int64_t vivant, pic;
+    long picRss = 0;
+    if (memoireActive)
+        lireMemoireGlobale(&vivant, &pic, &picRss);
+    pthread_mutex_lock(&verrouPhases);
+    int i = 0;
+    while (i < nbPhases && strcmp(phases[i].nom, phase) != 0)
+        i++;
+    if (i == nbPhases && nbPhases < MAX_PHASES)
+    {
+        strncpy(phases[i].nom, phase, LONGUEUR_PHASE - 1);
+        nbPhases++;
+    }
+    if (i < nbPhases)
+    {
+        phases[i].total += fin.ns - debut->ns;
+        phases[i].nombre++;
+        for (int e = 0; e < NB_EVENEMENTS; e++)
+            phases[i].materiel[e] += fin.materiel[e] - debut->materiel[e];
+        phases[i].alloue += fin.memoire.alloue - debut->memoire.alloue;
+        phases[i].retenu += (int64_t)(fin.memoire.alloue - debut->memoire.alloue) - (int64_t)(fin.memoire.libere - debut->memoire.libere);
+        phases[i].allocations += fin.memoire.allocations - debut->memoire.allocations;
+        if (picRss > phases[i].picRss)
+            phases[i].picRss = picRss;
+    }
+    pthread_mutex_unlock(&verrouPhases);
+}
+
+/**
+ * @fn void ajouterCompteur(Compteur compteur, uint64_t n)
+ * @brief Ajoute n à un compteur.
+ * @param[in] compteur Compteur.
+ * @param[in] n Valeur ajoutée.
+ */
+void ajouterCompteur(Compteur compteur, uint64_t n)
+{
+    atomic_fetch_add_explicit(&compteurs[compteur], n, memory_order_relaxed);
+}
+
+/**
+ * @fn static double dureePhase(const char *nom)
+ * @brief Durée cumulée d'une phase, en secondes.
+ * @param[in] nom Nom de la phase.
+ * @return Durée, 0 si la phase n'a pas été mesurée.
+ */
+static double dureePhase(const char *nom)
+{
+    for (int i = 0; i < nbPhases; i++)
+    {
+        if (strcmp(phases[i].nom, nom) == 0)
+            return phases[i].total / 1e9;
+    }
+    return 0;
+}
+
+/**
+ * @fn static void afficherTaille(FILE *out, double octets)
+ * @brief Affiche une taille en octets, Ko, Mo ou Go.
+ * @param[out] out Fichier de sortie.
+ * @param[in] octets Taille, éventuellement négative.
+ */
+static void afficherTaille(FILE *out, double octets)
+{
+    static const char *unites[] = {"o", "Ko", "Mo", "Go"};
+    int u = 0;
+    while (u < 3 && (octets >= 1024 || octets <= -1024))
+    {
+        octets /= 1024;
+        u++;
+    }
+    fprintf(out, u == 0 ? "%.0f %s" : "%.1f %s", octets, unites[u]);
+}
+
+/**
+ * @fn void afficherStatistiques(FILE *out, bool json)
+ * @brief Affiche les durées par phase, les compteurs et les débits.
+ * @param[out] out Fichier de sortie.
+ * @param[in] json Affichage en JSON plutôt qu'en texte.
+ */
+void afficherStatistiques(FILE *out, bool json)
+{
+    double total = (instantNs() - debutGlobal) / 1e9;
+    pthread_mutex_lock(&verrouPhases);
+
+    // Les débits sont rapportés au temps de chargement, qui comprend la lecture et l'analyse du fichier
+    double chargement = dureePhase("chargement");
+    uint64_t lignes = atomic_load(&compteurs[STAT_LIGNES]);
+    uint64_t octets = atomic_load(&compteurs[STAT_OCTETS]);
+    double lignesParSeconde = chargement > 0 ? lignes / chargement : 0;
+    double octetsParSeconde = chargement > 0 ? octets / chargement : 0;
+
+    // Les défauts sont rapportés au nombre de bulletins : chaque phase parcourt tous les bulletins lus
+    double parBulletin = lignes > 0 ? 1.0 / lignes : 0;
+
+    int64_t vivant = 0, picVivant = 0;
+    long picRss = 0;
+    if (memoireActive)
+        lireMemoireGlobale(&vivant, &picVivant, &picRss);
+
+    if (json)
+    {
+        fprintf(out, "{\"total_ms\": %.3f, \"phases\": {", total * 1e3);
+        for (int i = 0; i < nbPhases; i++)
+        {
+            Phase *p = &phases[i];
+            fprintf(out, "%s\"%s\": {\"ms\": %.3f, \"nombre\": %llu", i > 0 ? ", " : "", p->nom, p->total / 1e6, (unsigned long long)p->nombre);
+            if (materielActif)
+            {
+                for (int e = 0; e < NB_EVENEMENTS; e++)
+                {
+                    if (evenementDisponible(e))
+                        fprintf(out, ", \"%s\": %llu", nomsEvenements[e], (unsigned long long)p->materiel[e]);
+                }
+                if (evenementDisponible(EVT_CYCLES) && evenementDisponible(EVT_INSTRUCTIONS) && p->materiel[EVT_CYCLES] > 0)
+                    fprintf(out, ", \"ipc\": %.3f", (double)p->materiel[EVT_INSTRUCTIONS] / p->materiel[EVT_CYCLES]);
+                if (evenementDisponible(EVT_DEFAUTS_CACHE))
+                    fprintf(out, ", \"defauts_cache_par_bulletin\": %.4f", p->materiel[EVT_DEFAUTS_CACHE] * parBulletin);
+                if (evenementDisponible(EVT_DEFAUTS_BRANCHE))
+                    fprintf(out, ", \"defauts_branche_par_bulletin\": %.4f", p->materiel[EVT_DEFAUTS_BRANCHE] * parBulletin);
+            }
+            if (memoireActive)
+                fprintf(out, ", \"alloue\": %llu, \"retenu\": %lld, \"allocations\": %llu, \"pic_rss_ko\": %ld", (unsigned long long)p->alloue,
+                        (long long)p->retenu, (unsigned long long)p->allocations, p->picRss);
+            fprintf(out, "}");
+        }
+        fprintf(out, "}, \"compteurs\": {");
+        for (int c = 0; c < NB_COMPTEURS; c++)
+            fprintf(out, "%s\"%s\": %llu", c > 0 ? ", " : "", nomsCompteurs[c], (unsigned long long)atomic_load(&compteurs[c]));
+        fprintf(out, "}, \"lignes_par_s\": %.0f, \"octets_par_s\": %.0f", lignesParSeconde, octetsParSeconde);
+        if (memoireActive)
+            fprintf(out, ", \"memoire_vivante\": %lld, \"pic_tas\": %lld, \"pic_rss_ko\": %ld", (long long)vivant, (long long)picVivant, picRss);
+        fprintf(out, "}\n");
+    }
+    else
+    {
+        fprintf(out, "Statistiques : %.3f ms au total\n", total * 1e3);
+        for (int i = 0; i < nbPhases; i++)
+        {
+            Phase *p = &phases[i];
+            fprintf(out, "  %-16s %10.3f ms  (%llu fois)", p->nom, p->total / 1e6, (unsigned long long)p->nombre);
+            if (materielActif)
+            {
+                if (evenementDisponible(EVT_CYCLES) && evenementDisponible(EVT_INSTRUCTIONS) && p->materiel[EVT_CYCLES] > 0)
+                    fprintf(out, "  IPC %.2f", (double)p->materiel[EVT_INSTRUCTIONS] / p->materiel[EVT_CYCLES]);
+                if (evenementDisponible(EVT_DEFAUTS_CACHE))
+                    fprintf(out, "  cache %.3f/bulletin", p->materiel[EVT_DEFAUTS_CACHE] * parBulletin);
+                if (evenementDisponible(EVT_DEFAUTS_BRANCHE))
+                    fprintf(out, "  branches %.3f/bulletin", p->materiel[EVT_DEFAUTS_BRANCHE] * parBulletin);
+            }
+            if (memoireActive)
+            {
+                // La mémoire retenue est celle que la phase laisse derrière elle : ses structures, ou une fuite
+                fprintf(out, "  alloué ");
+                afficherTaille(out, p->alloue);
+                fprintf(out, ", retenu ");
+                afficherTaille(out, p->retenu);
+                fprintf(out, " (%llu allocations)", (unsigned long long)p->allocations);
+            }
+            fprintf(out, "\n");
+        }
+        for (int c = 0; c < NB_COMPTEURS; c++)
+            fprintf(out, "  %-16s %10llu\n", nomsCompteurs[c], (unsigned long long)atomic_load(&compteurs[c]));
+        fprintf(out, "  %-16s %10.0f\n", "lignes/s", lignesParSeconde);
+        fprintf(out, "  %-16s %10.0f\n", "octets/s", octetsParSeconde);
+        if (memoireActive)
+        {
+            fprintf(out, "  mémoire vivante  ");
+            afficherTaille(out, vivant);
+            fprintf(out, ", pic du tas ");
+            afficherTaille(out, picVivant);
+            fprintf(out, ", pic RSS ");
+            afficherTaille(out, picRss * 1024.0);
+            fprintf(out, "\n");
+        }
+    }
+    pthread_mutex_unlock(&verrouPhases);
+}
+
+#endif // STATISTIQUES_C
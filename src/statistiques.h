@@ -0,0 +1,136 @@
+/**
+ * @file statistiques.h
+ * @brief Mesure du temps passé dans chaque phase et compteurs d'activité (option --stats).
+ * @author Bibyk Bogdan
+ * @date 18 octobre 2026
+ *
+ * Ce fichier d'en-tête définit les chronomètres et les compteurs affichés par l'option --stats.
+ * Les durées sont mesurées avec l'horloge monotone et cumulées par phase (chargement, préparation,
+ * chaque méthode...). Avec l'option --perf, les compteurs matériels du processeur sont relevés aux
+ * mêmes points. Les allocations mémoire de chaque phase sont comptées elles aussi (voir memoire.h).
+ * Lorsque l'option n'est pas donnée, chaque mesure se réduit au test d'un booléen.
+ *
+ */
+
+#ifndef STATISTIQUES_H
+#define STATISTIQUES_H
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <time.h>
+#include "compteurs_materiels.h"
+#include "memoire.h"
+
+/**
+ * @enum Compteur
+ * @brief Compteurs d'activité.
+ */
+typedef enum Compteur
+{
+    STAT_LIGNES,        ///< Lignes de données lues (bulletins ou lignes de la matrice des duels).
+    STAT_OCTETS,        ///< Octets lus dans les fichiers d'entrée.
+    STAT_FICHIERS,      ///< Fichiers chargés.
+    STAT_PAIRES,        ///< Paires examinées par la méthode des paires.
+    STAT_CHEMINS,       ///< Chemins comparés par la méthode de Schulze.
+    NB_COMPTEURS
+} Compteur;
+
+/**
+ * @struct Instant
+ * @brief Horloge monotone et compteurs matériels relevés au début d'une phase.
+ */
+typedef struct Instant
+{
+    uint64_t ns;                       ///< Horloge monotone en nanosecondes.
+    uint64_t materiel[NB_EVENEMENTS];  ///< Compteurs matériels du thread, 0 s'ils sont inactifs.
+    EtatMemoire memoire;               ///< Allocations cumulées du thread.
+} Instant;
+
+/// Indique si les statistiques sont collectées (option --stats).
+extern bool statsActives;
+
+/**
+ * @def STATS_DEBUT(debut)
+ * @brief Déclare la variable debut et y relève l'instant courant si les statistiques sont actives.
+ */
+#define STATS_DEBUT(debut) Instant debut = statsActives ? instantCourant() : (Instant){0}
+
+/**
+ * @def STATS_FIN(debut, phase)
+ * @brief Cumule dans la phase le temps et les événements écoulés depuis STATS_DEBUT(debut).
+ */
+#define STATS_FIN(debut, phase)                                  \
+    do                                                           \
+    {                                                            \
+        if (statsActives)                                        \
+            enregistrerPhase((phase), &(debut));                 \
+    } while (0)
+
+/**
+ * @def STATS_AJOUTER(compteur, n)
+ * @brief Ajoute n à un compteur si les statistiques sont actives.
+ */
+#define STATS_AJOUTER(compteur, n)                               \
+    do                                                           \
+    {                                                            \
+        if (statsActives)                                        \
+            ajouterCompteur((compteur), (n));                    \
+    } while (0)
+
+/**
+ * @fn static inline uint64_t instantNs(void)
+ * @brief Lit l'horloge monotone.
+ * @return Instant en nanosecondes.
+ */
+static inline uint64_t instantNs(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @fn void activerStatistiques(bool materiel)
+ * @brief Active la collecte et démarre le chronomètre global.
+ * @param[in] materiel Relevé des compteurs matériels (option --perf), signalés sur stderr s'ils sont indisponibles.
+ */
+void activerStatistiques(bool materiel);
+
+/**
+ * @fn Instant instantCourant(void)
+ * @brief Relève l'horloge monotone et les compteurs matériels du thread appelant.
+ * @return Instant courant.
+ */
+Instant instantCourant(void);
+
+/**
+ * @fn void enregistrerPhase(const char *phase, const Instant *debut)
+ * @brief Cumule dans une phase, créée à sa première mesure, ce qui s'est écoulé depuis debut.
+ * @param[in] phase Nom de la phase (copié).
+ * @param[in] debut Instant relevé au début de la phase, dans le même thread.
+ *
+ * @note Peut être appelée depuis plusieurs threads.
+ */
+void enregistrerPhase(const char *phase, const Instant *debut);
+
+/**
+ * @fn void ajouterCompteur(Compteur compteur, uint64_t n)
+ * @brief Ajoute n à un compteur.
+ * @param[in] compteur Compteur.
+ * @param[in] n Valeur ajoutée.
+ *
+ * @note Peut être appelée depuis plusieurs threads.
+ */
+void ajouterCompteur(Compteur compteur, uint64_t n);
+
+/**
+ * @fn void afficherStatistiques(FILE *out, bool json)
+ * @brief Affiche les durées par phase, les compteurs et les débits.
+ * @param[out] out Fichier de sortie.
+ * @param[in] json Affichage en JSON plutôt qu'en texte.
+ */
+void afficherStatistiques(FILE *out, bool json);
+
+#endif
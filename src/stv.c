@@ -0,0 +1,385 @@
+/**
+ * @file stv.c
+ * @brief Vote alternatif (IRV) et vote unique transférable (STV).
+ * @author Bibyk Bogdan
+ * @date 18 octobre 2026
+ *
+ * Ce fichier contient l'implémentation du dépouillement par transferts successifs.
+ * Chaque bulletin est d'abord converti en liste ordonnée de candidats, découpée en groupes de
+ * candidats classés au même rang, puis rangé dans la pile de son candidat préféré. Un bulletin qui
+ * classe plusieurs candidats à égalité partage son poids entre eux : chacun reçoit une part. Quand
+ * un candidat est éliminé ou élu avec un excédent, seule sa pile est parcourue : chaque part est
+ * redistribuée entre les candidats en lice de son groupe, ou à défaut du groupe suivant.
+ *
+ */
+
+#ifndef STV_C
+#define STV_C
+
+#include "stv.h"
+
+/**
+ * @enum EtatCandidat
+ * @brief État d'un candidat pendant le dépouillement.
+ */
+typedef enum EtatCandidat
+{
+    EN_LICE, ///< Candidat encore en lice.
+    ELU,     ///< Candidat élu.
+    ELIMINE  ///< Candidat éliminé.
+} EtatCandidat;
+
+/**
+ * @struct Part
+ * @brief Part du poids d'un bulletin attribuée à un candidat.
+ */
+typedef struct Part
+{
+    int bulletin;  ///< Indice du bulletin.
+    int debut;     ///< Position, dans le classement du bulletin, du groupe du candidat soutenu.
+    double poids;  ///< Poids de la part (1 au départ, divisé entre les candidats à égalité et réduit par les transferts d'excédent).
+} Part;
+
+/**
+ * @struct Pile
+ * @brief Parts de bulletins soutenant actuellement un candidat.
+ */
+typedef struct Pile
+{
+    Part *parts;   ///< Parts de bulletins.
+    int taille;    ///< Nombre de parts dans la pile.
+    int capacite;  ///< Capacité allouée.
+} Pile;
+
+/**
+ * @struct Depouillement
+ * @brief État complet du dépouillement.
+ */
+typedef struct Depouillement
+{
+    int nb_candidates;    ///< Nombre de candidats.
+    int nb_bulletins;     ///< Nombre de bulletins.
+    int *ordres;          ///< ordres[b * nb_candidates + k] : k-ième candidat classé par le bulletin b.
+    bool *egalites;       ///< egalites[b * nb_candidates + k] : le k-ième et le (k+1)-ième candidat ont le même rang.
+    int *longueurs;       ///< Nombre de candidats classés par chaque bulletin.
+    Pile *piles;          ///< Pile de parts de bulletins de chaque candidat.
+    double *voix;         ///< Voix de chaque candidat.
+    EtatCandidat *etats;  ///< État de chaque candidat.
+    double epuises;       ///< Poids des bulletins qui ne classent plus aucun candidat en lice.
+} Depouillement;
+
+/**
+ * @fn static void *allocStvMem(size_t size)
+ * @brief Fonction d'allocation mémoire initialisée à zéro, avec arrêt du programme en cas d'échec.
+ * @param[in] size Taille à allouer.
+ * @return Pointeur vers la mémoire allouée.
+ */
+static void *allocStvMem(size_t size)
+{
+    void *ptr = calloc(1, size);
+    if (ptr == NULL)
+    {
+        perror("Erreur d'allocation mémoire");
+        exit(EXIT_FAILURE);
+    }
+    return ptr;
+}
+
+/**
+ * @fn static void empiler(Pile *pile, Part part)
+ * @brief Ajoute une part de bulletin à une pile.
+ * @param[in, out] pile Pile du candidat.
+ * @param[in] part Part du bulletin.
+ */
+static void empiler(Pile *pile, Part part)
+{
+    if (pile->taille == pile->capacite)
+    {
+        pile->capacite = pile->capacite == 0 ? 16 : 2 * pile->capacite;
+        pile->parts = realloc(pile->parts, pile->capacite * sizeof(Part));
+        if (pile->parts == NULL)
+        {
+            perror("Erreur d'allocation mémoire");
+            exit(EXIT_FAILURE);
+        }
+    }
+    pile->parts[pile->taille++] = part;
+}
+
+/**
+ * @fn static void classerBulletin(int *rangs, int nb_candidates, int *ordre, bool *egalites, int *longueur, int *tetes, int *suivants)
+ * @brief Convertit les rangs d'un bulletin en liste ordonnée de candidats, par tri par paquets en O(C).
+ * @param[in] rangs Rang donné à chaque candidat (-1 si non classé).
+ * @param[in] nb_candidates Nombre de candidats.
+ * @param[out] ordre Candidats classés, du préféré au moins préféré.
+ * @param[out] egalites Indique pour chaque position si le candidat suivant a le même rang.
+ * @param[out] longueur Nombre de candidats classés.
+ * @param[in] tetes Tableau de travail de nb_candidates + 1 cases.
+ * @param[in] suivants Tableau de travail de nb_candidates cases.
+ *
+ * @note Les rangs supérieurs au nombre de candidats sont ramenés au dernier rang.
+ */
+static void classerBulletin(int *rangs, int nb_candidates, int *ordre, bool *egalites, int *longueur, int *tetes, int *suivants)
+{
+    for (int r = 0; r <= nb_candidates; r++)
+        tetes[r] = -1;
+    for (int c = nb_candidates - 1; c >= 0; c--)
+    {
+        int rang = rangs[c] > nb_candidates ? nb_candidates : rangs[c];
+        if (rang < 1)
+            continue;
+        suivants[c] = tetes[rang];
+        tetes[rang] = c;
+    }
+
+    int k = 0;
+    for (int r = 1; r <= nb_candidates; r++)
+    {
+        for (int c = tetes[r]; c != -1; c = suivants[c])
+        {
+            egalites[k] = suivants[c] != -1;
+            ordre[k++] = c;
+        }
+    }
+    *longueur = k;
+}
+
+/**
+ * @fn static void repartir(Depouillement *d, int bulletin, int debut, double poids)
+ * @brief Partage un poids entre les candidats en lice du premier groupe, à partir d'une position, qui en compte.
+ * @param[in, out] d État du dépouillement.
+ * @param[in] bulletin Indice du bulletin.
+ * @param[in] debut Position du premier groupe examiné dans le classement du bulletin.
+ * @param[in] poids Poids à partager.
+ *
+ * @note Le poids est compté comme épuisé si aucun groupe suivant ne contient de candidat en lice.
+ */
+static void repartir(Depouillement *d, int bulletin, int debut, double poids)
+{
+    int *ordre = &d->ordres[(size_t)bulletin * d->nb_candidates];
+    bool *egalites = &d->egalites[(size_t)bulletin * d->nb_candidates];
+    int longueur = d->longueurs[bulletin];
+    while (debut < longueur)
+    {
+        int fin = debut + 1;
+        int enLice = d->etats[ordre[debut]] == EN_LICE;
+        while (egalites[fin - 1])
+            enLice += d->etats[ordre[fin++]] == EN_LICE;
+
+        if (enLice > 0)
+        {
+            Part part = {bulletin, debut, poids / enLice};
+            for (int k = debut; k < fin; k++)
+            {
+                if (d->etats[ordre[k]] != EN_LICE)
+                    continue;
+                empiler(&d->piles[ordre[k]], part);
+                d->voix[ordre[k]] += part.poids;
+            }
+            return;
+        }
+        debut = fin;
+    }
+    d->epuises += poids;
+}
+
+/**
+ * @fn static Depouillement *creerDepouillement(DataFrame *df, CandidateTable *candidates)
+ * @brief Prépare le dépouillement : classement de chaque bulletin et piles des premiers choix.
+ * @param[in] df DataFrame contenant les bulletins.
+ * @param[in] candidates Table des candidats.
+ * @return État initial du dépouillement.
+ */
+static Depouillement *creerDepouillement(DataFrame *df, CandidateTable *candidates)
+{
+    int nb_candidates = candidates->nb_candidates;
+    int nb_bulletins = df->num_rows;
+    Depouillement *d = allocStvMem(sizeof(Depouillement));
+    d->nb_candidates = nb_candidates;
+    d->nb_bulletins = nb_bulletins;
+    d->ordres = allocStvMem(((size_t)nb_bulletins * nb_candidates + 1) * sizeof(int));
+    d->egalites = allocStvMem(((size_t)nb_bulletins * nb_candidates + 1) * sizeof(bool));
+    d->longueurs = allocStvMem((nb_bulletins + 1) * sizeof(int));
+    d->piles = allocStvMem((nb_candidates + 1) * sizeof(Pile));
+    d->voix = allocStvMem((nb_candidates + 1) * sizeof(double));
+    d->etats = allocStvMem((nb_candidates + 1) * sizeof(EtatCandidat));
+
+    int rangs[nb_candidates + 1];
+    int tetes[nb_candidates + 1];
+    int suivants[nb_candidates + 1];
+    for (int b = 0; b < nb_bulletins; b++)
+    {
+        for (int c = 0; c < nb_candidates; c++)
+            rangs[c] = ((int *)df->columns[candidates->columns[c]].data)[b];
+        size_t decalage = (size_t)b * nb_candidates;
+        classerBulletin(rangs, nb_candidates, &d->ordres[decalage], &d->egalites[decalage], &d->longueurs[b], tetes, suivants);
+        repartir(d, b, 0, 1.0);
+    }
+    return d;
+}
+
+/**
+ * @fn static void transferer(Depouillement *d, int candidat, double facteur)
+ * @brief Transfère la pile d'un candidat élu ou éliminé vers les candidats suivants en lice.
+ * @param[in, out] d État du dépouillement.
+ * @param[in] candidat Candidat dont la pile est transférée.
+ * @param[in] facteur Part du poids de chaque bulletin transférée (1 pour une élimination).
+ *
+ * @note Une part revient d'abord aux candidats encore en lice classés au même rang que le candidat,
+ *       puis aux candidats du groupe suivant.
+ */
+static void transferer(Depouillement *d, int candidat, double facteur)
+{
+    Pile *pile = &d->piles[candidat];
+    for (int k = 0; k < pile->taille; k++)
+    {
+        Part *part = &pile->parts[k];
+        repartir(d, part->bulletin, part->debut, part->poids * facteur);
+    }
+    free(pile->parts);
+    pile->parts = NULL;
+    pile->taille = pile->capacite = 0;
+}
+
+/**
+ * @fn static void logTour(Depouillement *d, CandidateTable *candidates, int tour, FILE *log, bool debugMode)
+ * @brief Écrit les voix de chaque candidat en lice dans le fichier de log.
+ * @param[in] d État du dépouillement.
+ * @param[in] candidates Table des candidats.
+ * @param[in] tour Numéro du tour.
+ * @param[in] log Fichier de log.
+ * @param[in] debugMode Mode debug.
+ */
+static void logTour(Depouillement *d, CandidateTable *candidates, int tour, FILE *log, bool debugMode)
+{
+    if (!journalActif(debugMode, JOURNAL_DETAILS))
+        return;
+    fprintf(log, "Tour %d :\n", tour);
+    for (int c = 0; c < d->nb_candidates; c++)
+    {
+        if (d->etats[c] == EN_LICE)
+            fprintf(log, "\t%s : %.2f voix\n", candidates->names[c], d->voix[c]);
+    }
+    fprintf(log, "\tbulletins épuisés : %.2f\n", d->epuises);
+}
+
+/**
+ * @fn static int depouiller(Depouillement *d, CandidateTable *candidates, int nbSieges, FILE *log, bool debugMode, VoteResult *elus)
+ * @brief Dépouillement par transferts successifs jusqu'à ce que tous les sièges soient pourvus.
+ * @param[in, out] d État du dépouillement.
+ * @param[in] candidates Table des candidats.
+ * @param[in] nbSieges Nombre de sièges à pourvoir.
+ * @param[in] log Fichier de log.
+ * @param[in] debugMode Mode debug.
+ * @param[out] elus Résultat de chaque élu, dans l'ordre d'élection.
+ * @return Nombre d'élus.
+ */
+static int depouiller(Depouillement *d, CandidateTable *candidates, int nbSieges, FILE *log, bool debugMode, VoteResult *elus)
+{
+    // Quota de Droop
+    double quota = (double)(d->nb_bulletins / (nbSieges + 1) + 1);
+    int nbElus = 0;
+    int enLice = d->nb_candidates;
+    int tour = 1;
+    if (journalActif(debugMode, JOURNAL_DETAILS))
+        fprintf(log, "Quota : %.0f voix pour %d siège(s)\n", quota, nbSieges);
+
+    while (nbElus < nbSieges && enLice > 0)
+    {
+        logTour(d, candidates, tour++, log, debugMode);
+
+        // Meilleur et moins bon candidat en lice, à égalité le plus petit identifiant est favorisé
+        int meilleur = -1;
+        int moinsBon = -1;
+        for (int c = 0; c < d->nb_candidates; c++)
+        {
+            if (d->etats[c] != EN_LICE)
+                continue;
+            if (meilleur == -1 || d->voix[c] > d->voix[meilleur])
+                meilleur = c;
+            if (moinsBon == -1 || d->voix[c] <= d->voix[moinsBon])
+                moinsBon = c;
+        }
+
+        // Autant de sièges que de candidats en lice, ou quota atteint : le meilleur est élu
+        if (enLice <= nbSieges - nbElus || d->voix[meilleur] >= quota)
+        {
+            elus[nbElus++] = createVoteResult(candidates, d->nb_bulletins, d->voix[meilleur], meilleur);
+            logprintf(log, debugMode, JOURNAL_DETAILS, "\t=> %s élu avec %.2f voix\n", candidates->names[meilleur], d->voix[meilleur]);
+            d->etats[meilleur] = ELU;
+            enLice--;
+
+            // Méthode de Gregory : chaque bulletin transfère la part excédentaire de son poids
+            double excedent = d->voix[meilleur] - quota;
+            transferer(d, meilleur, excedent > 0 ? excedent / d->voix[meilleur] : 0.0);
+        }
+        else
+        {
+            logprintf(log, debugMode, JOURNAL_DETAILS, "\t=> %s éliminé\n", candidates->names[moinsBon]);
+            d->etats[moinsBon] = ELIMINE;
+            enLice--;
+            transferer(d, moinsBon, 1.0);
+        }
+    }
+    logprintf(log, debugMode, JOURNAL_RESULTATS, "\n");
+    return nbElus;
+}
+
+/**
+ * @fn static void supprimerDepouillement(Depouillement *d)
+ * @brief Libère l'état du dépouillement.
+ * @param[in] d État du dépouillement.
+ */
+static void supprimerDepouillement(Depouillement *d)
+{
+    for (int c = 0; c < d->nb_candidates; c++)
+        free(d->piles[c].parts);
+    free(d->ordres);
+    free(d->egalites);
+    free(d->longueurs);
+    free(d->piles);
+    free(d->voix);
+    free(d->etats);
+    free(d);
+}
+
+/**
+ * @fn int voteUniqueTransferable(DataFrame *df, CandidateTable *candidates, int nbSieges, FILE *log, bool debugMode, VoteResult *elus)
+ * @brief Fonction pour effectuer un vote unique transférable.
+ * @param[in] df Pointeur vers le DataFrame contenant les résultats du vote.
+ * @param[in] candidates Table des candidats.
+ * @param[in] nbSieges Nombre de sièges à pourvoir.
+ * @param[in] log Pointeur vers le fichier de test des sorties.
+ * @param[in] debugMode Indique si le mode débogage est activé.
+ * @param[out] elus Résultat de chaque élu, dans l'ordre d'élection.
+ * @return Nombre d'élus.
+ */
+int voteUniqueTransferable(DataFrame *df, CandidateTable *candidates, int nbSieges, FILE *log, bool debugMode, VoteResult *elus)
+{
+    logprintf(log, debugMode, JOURNAL_RESULTATS, "VOTE UNIQUE TRANSFERABLE :\n");
+    Depouillement *d = creerDepouillement(df, candidates);
+    int nbElus = depouiller(d, candidates, nbSieges, log, debugMode, elus);
+    supprimerDepouillement(d);
+    return nbElus;
+}
+
+/**
+ * @fn VoteResult voteAlternatif(DataFrame *df, CandidateTable *candidates, FILE *log, bool debugMode)
+ * @brief Fonction pour effectuer un vote alternatif (instant-runoff).
+ * @param[in] df Pointeur vers le DataFrame contenant les résultats du vote.
+ * @param[in] candidates Table des candidats.
+ * @param[in] log Pointeur vers le fichier de test des sorties.
+ * @param[in] debugMode Indique si le mode débogage est activé.
+ * @return Structure VoteResult contenant le vainqueur et ses voix au dernier tour.
+ */
+VoteResult voteAlternatif(DataFrame *df, CandidateTable *candidates, FILE *log, bool debugMode)
+{
+    logprintf(log, debugMode, JOURNAL_RESULTATS, "VOTE ALTERNATIF :\n");
+    VoteResult vainqueur = createVoteResult(candidates, df->num_rows, 0, -1);
+    Depouillement *d = creerDepouillement(df, candidates);
+    depouiller(d, candidates, 1, log, debugMode, &vainqueur);
+    supprimerDepouillement(d);
+    return vainqueur;
+}
+
+#endif // STV_C
@@ -0,0 +1,55 @@
+/**
+ * @file stv.h
+ * @brief Vote alternatif (IRV) et vote unique transférable (STV).
+ * @author Bibyk Bogdan
+ * @date 18 octobre 2026
+ *
+ * Ce fichier d'en-tête définit les fonctions de dépouillement par transferts successifs :
+ * - vote alternatif : un siège, le candidat le moins bien placé est éliminé à chaque tour ;
+ * - vote unique transférable : plusieurs sièges, quota de Droop et transfert des excédents
+ *   par la méthode de Gregory (poids fractionnaires).
+ * Un bulletin qui classe plusieurs candidats au même rang partage son poids à parts égales entre
+ * ceux qui sont encore en lice.
+ *
+ */
+
+#ifndef STV_H
+#define STV_H
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include "lecture_csv.h"
+#include "candidats.h"
+#include "utils.h"
+
+/**
+ * @fn VoteResult voteAlternatif(DataFrame *df, CandidateTable *candidates, FILE *log, bool debugMode)
+ * @brief Fonction pour effectuer un vote alternatif (instant-runoff).
+ * @param[in] df Pointeur vers le DataFrame contenant les résultats du vote.
+ * @param[in] candidates Table des candidats.
+ * @param[in] log Pointeur vers le fichier de test des sorties.
+ * @param[in] debugMode Indique si le mode débogage est activé.
+ * @return Structure VoteResult contenant le vainqueur et ses voix au dernier tour.
+ */
+VoteResult voteAlternatif(DataFrame *df, CandidateTable *candidates, FILE *log, bool debugMode);
+
+/**
+ * @fn int voteUniqueTransferable(DataFrame *df, CandidateTable *candidates, int nbSieges, FILE *log, bool debugMode, VoteResult *elus)
+ * @brief Fonction pour effectuer un vote unique transférable.
+ * @param[in] df Pointeur vers le DataFrame contenant les résultats du vote.
+ * @param[in] candidates Table des candidats.
+ * @param[in] nbSieges Nombre de sièges à pourvoir.
+ * @param[in] log Pointeur vers le fichier de test des sorties.
+ * @param[in] debugMode Indique si le mode débogage est activé.
+ * @param[out] elus Résultat de chaque élu, dans l'ordre d'élection (nbSieges cases).
+ * @return Nombre d'élus, inférieur à nbSieges s'il y a moins de candidats que de sièges.
+ *
+ * @note Chaque part de bulletin est rangée dans la pile du candidat qu'elle soutient, avec la position
+ *       de son groupe dans le classement. Une élimination ou un transfert d'excédent ne parcourt que
+ *       la pile concernée et les groupes ne font qu'avancer : sans égalité, le dépouillement complet
+ *       est en O(V·C).
+ */
+int voteUniqueTransferable(DataFrame *df, CandidateTable *candidates, int nbSieges, FILE *log, bool debugMode, VoteResult *elus);
+
+#endif
@@ -0,0 +1,257 @@
+/**
+ * @file tests.c
+ * @brief Tests de non-régression des calculs dont le résultat ne se vérifie pas à l'œil.
+ * @author Bibyk Bogdan
+ * @date 18 octobre 2026
+ *
+ * Ce programme compare le moteur incrémental Condorcet, bulletin après bulletin, à un calcul
+ * complet sur la même matrice des duels, et les méthodes positionnelles à des scores calculés
+ * à la main. Il s'arrête avec un code d'erreur au premier écart.
+ *
+ */
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdbool.h>
+#include <math.h>
+#include "../lecture_csv.h"
+#include "../candidats.h"
+#include "../duels.h"
+#include "../condorcet.h"
+#include "../condorcet_incremental.h"
+#include "../positionnel.h"
+#include "../execution.h"
+
+/// Nombre de vérifications réussies.
+static int nbVerifications = 0;
+
+/**
+ * @def VERIFIER(condition, ...)
+ * @brief Arrête les tests avec un message si la condition est fausse.
+ */
+#define VERIFIER(condition, ...)                                  \
+    do                                                            \
+    {                                                             \
+        if (!(condition))                                         \
+        {                                                         \
+            fprintf(stderr, "%s:%d : ", __FILE__, __LINE__);      \
+            fprintf(stderr, __VA_ARGS__);                         \
+            fprintf(stderr, "\n");                                \
+            exit(EXIT_FAILURE);                                   \
+        }                                                         \
+        nbVerifications++;                                        \
+    } while (0)
+
+/**
+ * @fn static CandidateTable *candidatsNumerotes(int nb_candidates)
+ * @brief Table de candidats nommés C0, C1...
+ * @param[in] nb_candidates Nombre de candidats.
+ * @return Table des candidats.
+ */
+static CandidateTable *candidatsNumerotes(int nb_candidates)
+{
+    char noms[nb_candidates + 1][16];
+    char *pointeurs[nb_candidates + 1];
+    for (int c = 0; c < nb_candidates; c++)
+    {
+        snprintf(noms[c], sizeof(noms[c]), "C%d", c);
+        pointeurs[c] = noms[c];
+    }
+    return createCandidateTableFromNames(pointeurs, nb_candidates);
+}
+
+/**
+ * @fn static void comparerAuCalculComplet(IncrementalCondorcet *engine, DuelMatrix *reference, CandidateTable *candidates)
+ * @brief Vérifie que chaque résultat du moteur est celui du calcul complet sur la matrice de référence.
+ * @param[in, out] engine Moteur incrémental.
+ * @param[in] reference Matrice des duels recalculée avec addBallot et addTruncatedBallot.
+ * @param[in] candidates Table des candidats.
+ */
+static void comparerAuCalculComplet(IncrementalCondorcet *engine, DuelMatrix *reference, CandidateTable *candidates)
+{
+    int nb_candidates = reference->nb_candidates;
+    VERIFIER(memcmp(engine->duels->wins, reference->wins, (size_t)nb_candidates * nb_candidates * sizeof(int)) == 0,
+             "matrice des duels différente après %d bulletins", reference->nb_ballots);
+    VERIFIER(incrementalCondorcetWinner(engine) == findCondorcetWinner(reference), "vainqueur de Condorcet différent");
+
+    actualiserIncrementalCondorcet(engine);
+    VoteResult attendus[NB_VARIANTES_MINIMAX];
+    VoteResult obtenus[NB_VARIANTES_MINIMAX];
+    voteCondorcetMinimaxVariantes(reference, candidates, NULL, false, attendus);
+    incrementalMinimaxVariantes(engine, NULL, false, obtenus);
+    for (int v = 0; v < NB_VARIANTES_MINIMAX; v++)
+        VERIFIER(obtenus[v].winner == attendus[v].winner && obtenus[v].score == attendus[v].score,
+                 "minimax (%s) : %d (%g) au lieu de %d (%g)", nomVarianteMinimax(v), obtenus[v].winner, obtenus[v].score,
+                 attendus[v].winner, attendus[v].score);
+
+    VERIFIER(incrementalSchulze(engine, NULL, false).winner == voteCondorcetSchulzeDuels(reference, candidates, NULL, false).winner,
+             "vainqueur de Schulze différent après %d bulletins", reference->nb_ballots);
+    VERIFIER(incrementalPaires(engine, NULL, false).winner == voteCondorcetPairesDuels(reference, candidates, NULL, false).winner,
+             "vainqueur des paires différent");
+
+    // Des chemins gardés en cache doivent être exactement ceux d'un recalcul
+    if (!engine->chemins_dirty)
+    {
+        int chemins[nb_candidates * nb_candidates + 1];
+        calculerCheminsFort(reference, chemins);
+        VERIFIER(memcmp(chemins, engine->chemins, (size_t)nb_candidates * nb_candidates * sizeof(int)) == 0,
+                 "chemins de Schulze gardés en cache alors qu'ils ont changé");
+    }
+}
+
+/**
+ * @fn static void testerMoteurIncremental(int nb_candidates, int nb_bulletins, unsigned int graine)
+ * @brief Ajoute des bulletins aléatoires (complets, tronqués, avec égalités) et compare après chacun.
+ * @param[in] nb_candidates Nombre de candidats.
+ * @param[in] nb_bulletins Nombre de bulletins.
+ * @param[in] graine Graine du générateur.
+ */
+static void testerMoteurIncremental(int nb_candidates, int nb_bulletins, unsigned int graine)
+{
+    srand(graine);
+    CandidateTable *candidates = candidatsNumerotes(nb_candidates);
+    IncrementalCondorcet *engine = createIncrementalCondorcet(candidates);
+    DuelMatrix *reference = createDuelMatrix(nb_candidates);
+    int sansVainqueur = 0;
+
+    for (int b = 0; b < nb_bulletins; b++)
+    {
+        int ordre[nb_candidates + 1];
+        for (int c = 0; c < nb_candidates; c++)
+            ordre[c] = c;
+        for (int c = nb_candidates - 1; c > 0; c--)
+        {
+            int k = rand() % (c + 1);
+            int t = ordre[c];
+            ordre[c] = ordre[k];
+            ordre[k] = t;
+        }
+
+        if (rand() % 3 == 0)
+        {
+            // Bulletin avec égalités et candidats non classés
+            int rangs[nb_candidates + 1];
+            for (int c = 0; c < nb_candidates; c++)
+                rangs[c] = rand() % 4 == 0 ? -1 : 1 + rand() % nb_candidates;
+            addBallot(reference, rangs);
+            addBallotIncremental(engine, rangs);
+        }
+        else
+        {
+            int nb_classes = 1 + rand() % nb_candidates;
+            addTruncatedBallot(reference, ordre, nb_classes);
+            addTruncatedBallotIncremental(engine, ordre, nb_classes);
+        }
+        comparerAuCalculComplet(engine, reference, candidates);
+        sansVainqueur += incrementalCondorcetWinner(engine) == -1;
+    }
+
+    printf("  %d candidats, %d bulletins : %d sans vainqueur de Condorcet, %d recalculs des chemins\n",
+           nb_candidates, nb_bulletins, sansVainqueur, engine->nb_recalculs_chemins);
+    deleteDuelMatrix(reference);
+    deleteIncrementalCondorcet(engine);
+    deleteCandidateTable(candidates);
+}
+
+/**
+ * @fn static void testerAjoutElection(char *chemin, bool earlyExit)
+ * @brief Ajoute des bulletins à une élection chargée, comme le mode service, et compare ses méthodes Condorcet.
+ * @param[in] chemin Fichier de bulletins.
+ * @param[in] earlyExit Matrice des duels préparée avec arrêt anticipé, sinon partagée avec le dépouillement.
+ */
+static void testerAjoutElection(char *chemin, bool earlyExit)
+{
+    Election election;
+    VERIFIER(chargerElection(&election, chemin, false), "%s : %s", chemin, erreurLecture());
+    int nb_candidates = election.candidates->nb_candidates;
+    OptionsScrutin options = {false, earlyExit, 1, echelleMentions(6), true};
+    char *methodes[] = {"cm", "cs", "cp", "uni2"};
+    // Matrice arrêtée avant la fin ou partagée avec le dépouillement : le moteur doit repartir d'un décompte complet
+    preparerElection(&election, methodes, 4, &options);
+
+    DuelMatrix *reference = createDuelMatrixFromDf(election.df, election.candidates, false);
+    srand(7);
+    for (int b = 0; b < 200; b++)
+    {
+        int rangs[nb_candidates + 1];
+        for (int c = 0; c < nb_candidates; c++)
+            rangs[c] = rand() % 5 == 0 ? -1 : 1 + rand() % nb_candidates;
+        ajouterBulletinElection(&election, rangs);
+        addBallot(reference, rangs);
+
+        preparerElection(&election, methodes, 3, &options);
+        ResultatMethode obtenus[nbResultatsMax(&options)];
+        VERIFIER(calculerMethode("cs", &election, &options, NULL, obtenus) == 1
+                     && obtenus[0].resultat.winner == voteCondorcetSchulzeDuels(reference, election.candidates, NULL, false).winner
+                     && obtenus[0].resultat.nb_voters == reference->nb_ballots,
+                 "%s : Schulze différent après %d ajouts", chemin, b + 1);
+        VERIFIER(calculerMethode("cp", &election, &options, NULL, obtenus) == 1
+                     && obtenus[0].resultat.winner == voteCondorcetPairesDuels(reference, election.candidates, NULL, false).winner,
+                 "%s : paires différent après %d ajouts", chemin, b + 1);
+        VoteResult attendus[NB_VARIANTES_MINIMAX];
+        voteCondorcetMinimaxVariantes(reference, election.candidates, NULL, false, attendus);
+        VERIFIER(calculerMethode("cm", &election, &options, NULL, obtenus) == 3
+                     && obtenus[0].resultat.winner == attendus[MINIMAX_MARGES].winner
+                     && obtenus[2].resultat.winner == attendus[MINIMAX_OPPOSITION].winner,
+                 "%s : minimax différent après %d ajouts", chemin, b + 1);
+    }
+    printf("  %s : 200 bulletins ajoutés à %d votants\n", chemin, election.df->num_rows);
+
+    deleteDuelMatrix(reference);
+    fermerElection(&election);
+}
+
+/**
+ * @fn static void testerPositionnel(void)
+ * @brief Méthodes positionnelles sur un fichier dont les rangs ont des égalités et des trous.
+ *
+ * data/egalites.csv contient les bulletins (A, B, C, D) : (1, 3, 3, 7), (2, 2, -1, 5), (4, 1, 9, 4) et (1, 2, 3, 3).
+ * Les positions suivent l'ordre des rangs : B et C se partagent les positions 2 et 3 du premier bulletin,
+ * et C et D la dernière position du quatrième, où chacun ne reçoit qu'un demi-point d'anti-pluralité.
+ */
+static void testerPositionnel(void)
+{
+    Election election;
+    VERIFIER(chargerElection(&election, "data/egalites.csv", false), "data/egalites.csv : %s", erreurLecture());
+    Histogramme *histo = createHistogramme(election.df, election.candidates);
+
+    // Positions 1 à 4 puis non classé, pour A, B, C et D
+    double attendu[4][5] = {{2.5, 1, 0.5, 0, 0}, {1.5, 2, 0.5, 0, 0}, {0, 0.5, 1, 1.5, 1}, {0, 0.5, 2, 1.5, 0}};
+    for (int c = 0; c < 4; c++)
+        for (int p = 0; p < 5; p++)
+            VERIFIER(fabs(HISTO(histo, c, p) - attendu[c][p]) < 1e-9, "histogramme de %s, position %d : %g au lieu de %g",
+                     election.candidates->names[c], p + 1, HISTO(histo, c, p), attendu[c][p]);
+
+    // Borda : A 10, B 9, C 2, D 3 ; Dowdall : A 19/6, B 8/3 ; anti-pluralité : A et B 4, départagés par l'identifiant
+    VoteResult borda = voteBorda(histo, election.candidates, NULL, false);
+    VERIFIER(borda.winner == 0 && fabs(borda.score - 10) < 1e-4, "Borda : %d (%g)", borda.winner, borda.score);
+    VoteResult dowdall = voteDowdall(histo, election.candidates, NULL, false);
+    VERIFIER(dowdall.winner == 0 && fabs(dowdall.score - 19.0 / 6) < 1e-4, "Dowdall : %d (%g)", dowdall.winner, dowdall.score);
+    VoteResult anti = voteAntiPluralite(histo, election.candidates, NULL, false);
+    VERIFIER(anti.winner == 0 && fabs(anti.score - 4) < 1e-4, "anti-pluralité : %d (%g)", anti.winner, anti.score);
+    int tour;
+    VoteResult bucklin = voteBucklin(histo, election.candidates, NULL, false, &tour);
+    VERIFIER(bucklin.winner == 0 && tour == 1 && fabs(bucklin.score - 2.5) < 1e-4, "Bucklin : %d (%g) au tour %d",
+             bucklin.winner, bucklin.score, tour);
+    printf("  data/egalites.csv : %d bulletins\n", histo->nb_ballots);
+
+    deleteHistogramme(histo);
+    fermerElection(&election);
+}
+
+int main(void)
+{
+    printf("Moteur incrémental Condorcet :\n");
+    testerMoteurIncremental(3, 2000, 1);
+    testerMoteurIncremental(5, 2000, 2);
+    testerMoteurIncremental(8, 1000, 3);
+    testerMoteurIncremental(20, 300, 4);
+    testerAjoutElection("data/vote100.csv", true);
+    testerAjoutElection("data/VoteCondorcet.csv", false);
+    printf("Méthodes positionnelles :\n");
+    testerPositionnel();
+
+    printf("%d vérifications réussies\n", nbVerifications);
+    return EXIT_SUCCESS;
+}
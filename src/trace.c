@@ -0,0 +1,183 @@
+/**
+ * @file trace.c
+ * @brief Export des phases de chaque thread au format Chrome trace-event (option --trace).
+ * @author Bibyk Bogdan
+ * @date 18 octobre 2026
+ *
+ * Ce fichier contient l'enregistrement des événements. Un thread remplit son tampon courant, puis
+ * en alloue un autre lorsqu'il est plein ; chaque nouveau tampon est ajouté en tête de la liste
+ * globale par compare-and-swap. Les tampons des threads terminés restent dans la liste jusqu'à
+ * l'écriture du fichier.
+ *
+ */
+
+#ifndef TRACE_C
+#define TRACE_C
+
+#include <string.h>
+#include <stdatomic.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include "trace.h"
+#include "statistiques.h"
+
+/// Nombre d'événements d'un tampon.
+#define EVENEMENTS_PAR_TAMPON 1024
+/// Longueur maximale du nom d'un événement, comme celui d'une phase.
+#define LONGUEUR_NOM_TRACE 32
+
+/**
+ * @struct EvenementTrace
+ * @brief Phase exécutée par un thread.
+ */
+typedef struct EvenementTrace
+{
+    char nom[LONGUEUR_NOM_TRACE]; ///< Nom de la phase.
+    uint64_t debut;               ///< Début en nanosecondes, horloge monotone.
+    uint64_t fin;                 ///< Fin en nanosecondes, horloge monotone.
+} EvenementTrace;
+
+/**
+ * @struct TamponTrace
+ * @brief Événements d'un thread, écrits par lui seul.
+ */
+typedef struct TamponTrace
+{
+    long tid;                                          ///< Identifiant système du thread.
+    _Atomic int nombre;                                ///< Nombre d'événements complets.
+    EvenementTrace evenements[EVENEMENTS_PAR_TAMPON];  ///< Événements.
+    struct TamponTrace *suivant;                       ///< Tampon suivant dans la liste globale.
+} TamponTrace;
+
+bool traceActive = false;
+
+/// Fichier de trace, ouvert à l'activation.
+static FILE *fichierTrace = NULL;
+/// Origine des horodatages.
+static uint64_t origine;
+/// Liste de tous les tampons, le plus récent en tête.
+static _Atomic(TamponTrace *) tampons = NULL;
+/// Tampon courant du thread.
+static _Thread_local TamponTrace *tamponThread = NULL;
+
+/**
+ * @fn void activerTrace(char *chemin)
+ * @brief Crée le fichier de trace et active l'enregistrement des phases.
+ * @param[in] chemin Chemin du fichier JSON.
+ *
+ * @note Le programme s'arrête si le fichier ne peut pas être créé.
+ */
+void activerTrace(char *chemin)
+{
+    fichierTrace = fopen(chemin, "w");
+    if (fichierTrace == NULL)
+    {
+        perror(chemin);
+        exit(EXIT_FAILURE);
+    }
+    origine = instantNs();
+    traceActive = true;
+    // Les phases sont relevées par les sondes des statistiques
+    statsActives = true;
+}
+
+/**
+ * @fn static TamponTrace *nouveauTampon(void)
+ * @brief Alloue un tampon pour le thread appelant et l'ajoute à la liste globale.
+ * @return Tampon vide.
+ */
+static TamponTrace *nouveauTampon(void)
+{
+    TamponTrace *tampon = malloc(sizeof(TamponTrace));
+    if (tampon == NULL)
+    {
+        perror("malloc");
+        exit(EXIT_FAILURE);
+    }
+    tampon->tid = syscall(SYS_gettid);
+    atomic_init(&tampon->nombre, 0);
+    tampon->suivant = atomic_load_explicit(&tampons, memory_order_relaxed);
+    while (!atomic_compare_exchange_weak_explicit(&tampons, &tampon->suivant, tampon, memory_order_release, memory_order_relaxed))
+        ;
+    return tampon;
+}
+
+/**
+ * @fn void tracerPhase(const char *phase, uint64_t debutNs, uint64_t finNs)
+ * @brief Enregistre une phase du thread appelant.
+ * @param[in] phase Nom de la phase (copié).
+ * @param[in] debutNs Début, horloge monotone en nanosecondes.
+ * @param[in] finNs Fin, horloge monotone en nanosecondes.
+ */
+void tracerPhase(const char *phase, uint64_t debutNs, uint64_t finNs)
+{
+    TamponTrace *tampon = tamponThread;
+    if (tampon == NULL || atomic_load_explicit(&tampon->nombre, memory_order_relaxed) == EVENEMENTS_PAR_TAMPON)
+        tampon = tamponThread = nouveauTampon();
+
+    // L'événement est rempli avant d'être compté : l'écriture du fichier ne lit que des événements complets
+    int n = atomic_load_explicit(&tampon->nombre, memory_order_relaxed);
+    EvenementTrace *evenement = &tampon->evenements[n];
+    strncpy(evenement->nom, phase, LONGUEUR_NOM_TRACE - 1);
+    evenement->nom[LONGUEUR_NOM_TRACE - 1] = '\0';
+    evenement->debut = debutNs;
+    evenement->fin = finNs;
+    atomic_store_explicit(&tampon->nombre, n + 1, memory_order_release);
+}
+
+/**
+ * @fn static void ecrireChaineJson(FILE *out, const char *chaine)
+ * @brief Écrit une chaîne JSON entre guillemets, caractères spéciaux échappés.
+ * @param[out] out Fichier de sortie.
+ * @param[in] chaine Chaîne.
+ */
+static void ecrireChaineJson(FILE *out, const char *chaine)
+{
+    fputc('"', out);
+    for (const unsigned char *c = (const unsigned char *)chaine; *c != '\0'; c++)
+    {
+        if (*c == '"' || *c == '\\')
+            fprintf(out, "\\%c", *c);
+        else if (*c < 0x20)
+            fprintf(out, "\\u%04x", *c);
+        else
+            fputc(*c, out);
+    }
+    fputc('"', out);
+}
+
+/**
+ * @fn void ecrireTrace(void)
+ * @brief Écrit les événements de tous les threads dans le fichier de trace, puis le ferme.
+ */
+void ecrireTrace(void)
+{
+    if (!traceActive)
+        return;
+    traceActive = false;
+
+    long pid = getpid();
+    FILE *out = fichierTrace;
+    fprintf(out, "{\"traceEvents\": [\n");
+    fprintf(out, "{\"name\": \"process_name\", \"ph\": \"M\", \"pid\": %ld, \"tid\": %ld, \"args\": {\"name\": \"scrutin\"}},\n", pid, pid);
+    fprintf(out, "{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": %ld, \"tid\": %ld, \"args\": {\"name\": \"principal\"}}", pid, pid);
+
+    // Les horodatages sont en microsecondes depuis l'activation, les durées « X » évitent d'apparier début et fin
+    for (TamponTrace *tampon = atomic_load_explicit(&tampons, memory_order_acquire); tampon != NULL; tampon = tampon->suivant)
+    {
+        int nombre = atomic_load_explicit(&tampon->nombre, memory_order_acquire);
+        for (int i = 0; i < nombre; i++)
+        {
+            EvenementTrace *evenement = &tampon->evenements[i];
+            fprintf(out, ",\n{\"name\": ");
+            ecrireChaineJson(out, evenement->nom);
+            fprintf(out, ", \"cat\": \"phase\", \"ph\": \"X\", \"ts\": %.3f, \"dur\": %.3f, \"pid\": %ld, \"tid\": %ld}",
+                    (double)(evenement->debut - origine) / 1e3, (double)(evenement->fin - evenement->debut) / 1e3, pid, tampon->tid);
+        }
+    }
+    fprintf(out, "\n], \"displayTimeUnit\": \"ms\"}\n");
+    fclose(out);
+    fichierTrace = NULL;
+}
+
+#endif // TRACE_C
@@ -0,0 +1,55 @@
+/**
+ * @file trace.h
+ * @brief Export des phases de chaque thread au format Chrome trace-event (option --trace).
+ * @author Bibyk Bogdan
+ * @date 18 octobre 2026
+ *
+ * Ce fichier d'en-tête définit la trace d'exécution. Chaque phase mesurée par STATS_DEBUT et
+ * STATS_FIN (chargement, comptage, duels, chaque méthode...) devient un événement avec son thread,
+ * son début et sa durée. Le fichier produit s'ouvre dans chrome://tracing ou ui.perfetto.dev.
+ *
+ * Chaque thread enregistre ses événements dans ses propres tampons, sans verrou : le coût d'un
+ * événement est celui de deux lectures d'horloge et d'une copie de nom.
+ *
+ */
+
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+/// Indique si les phases sont tracées (option --trace).
+extern bool traceActive;
+
+/**
+ * @fn void activerTrace(char *chemin)
+ * @brief Crée le fichier de trace et active l'enregistrement des phases.
+ * @param[in] chemin Chemin du fichier JSON.
+ *
+ * @note Le programme s'arrête si le fichier ne peut pas être créé.
+ */
+void activerTrace(char *chemin);
+
+/**
+ * @fn void tracerPhase(const char *phase, uint64_t debutNs, uint64_t finNs)
+ * @brief Enregistre une phase du thread appelant.
+ * @param[in] phase Nom de la phase (copié).
+ * @param[in] debutNs Début, horloge monotone en nanosecondes.
+ * @param[in] finNs Fin, horloge monotone en nanosecondes.
+ *
+ * @note Peut être appelée depuis plusieurs threads.
+ */
+void tracerPhase(const char *phase, uint64_t debutNs, uint64_t finNs);
+
+/**
+ * @fn void ecrireTrace(void)
+ * @brief Écrit les événements de tous les threads dans le fichier de trace, puis le ferme.
+ *
+ * @note Les threads qui tracent encore peuvent continuer : leurs événements suivants sont ignorés.
+ */
+void ecrireTrace(void);
+
+#endif
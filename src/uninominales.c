@@ -17,80 +17,58 @@
 ///                                 UNINOMINAL 1 TOUR
 ///====================================================================================
 
-// Fonction auxiliaire pour trouver le gagnant d'un vote uninominal à un tour
-char *gagnantUninominalUnTour(DataFrame *df, int *nbVotes, char *columnToSkip)
+// Fonction auxiliaire qui compte les premières places dans la colonne de rangs d'un candidat
+// La boucle ne contient ni branchement ni appel : le compilateur peut la vectoriser
+static int compterPremieresPlaces(const int *rangs, int nbLignes)
 {
-    int numCandidates = df->num_columns - 4;
-    int *votes = (int *)malloc(numCandidates * sizeof(int));
-    char **candidats = (char **)malloc(numCandidates * sizeof(char *));
-    
-    for (int i = 0; i < numCandidates; i++)
-    {
-        votes[i] = 0;
-        candidats[i] = df->columns[i + 4].name;
-    }
-   
-    char *columns_names[df->num_columns];
-    getColumnsNames(df, columns_names);
-    
-    Column reponses = dfSelect(df, columns_names[0]);
-    for (int i = 0; i < df->num_rows; i++)
-    {
-        char response[100];
-        sprintf(response, "%d", ((int *)reponses.data)[i]);
-        Series row = getRow(df, columns_names[0], response);
-        for (int j = 0; j < df->num_columns; j++)
-        {
-            Item item = row.items[j];
-            if (columnToSkip != NULL && strcmp(item.label, columnToSkip) == 0)
-                continue;
-
-            if (item.type == INT && *(item.value.int_value) == 1)
-            {
-                votes[j - 4] += 1;
-                continue;
-            }
-        }
-    }
+    int nb = 0;
+    for (int i = 0; i < nbLignes; i++)
+        nb += rangs[i] == 1;
+    return nb;
+}
 
-    // Recherche du candidat avec le plus grand nombre de votes
-    int maxVotes = votes[0];
-    int gagnantIndex = 0;
+// Fonction auxiliaire pour trouver le gagnant d'un vote uninominal à un tour
+// Chaque colonne de rangs n'est parcourue qu'une fois, en O(V·C)
+int gagnantUninominalUnTour(DataFrame *df, CandidateTable *candidates, int *nbVotes, int candidatToSkip)
+{
+    int numCandidates = candidates->nb_candidates;
+    int gagnantIndex = -1;
+    int maxVotes = 0;
 
-    for (int i = 1; i < numCandidates; i++)
+    for (int c = 0; c < numCandidates; c++)
     {
-        if (votes[i] > maxVotes)
+        if (c == candidatToSkip)
+            continue;
+
+        int votes = compterPremieresPlaces((int *)df->columns[candidates->columns[c]].data, df->num_rows);
+        if (gagnantIndex == -1 || votes > maxVotes)
         {
-            maxVotes = votes[i];
-            gagnantIndex = i;
+            maxVotes = votes;
+            gagnantIndex = c;
         }
     }
 
     // Enregistrement du nombre de votes pour le gagnant
     *nbVotes = maxVotes;
 
-    free(votes);
-
-    // Retour du nom du candidat gagnant
-    return candidats[gagnantIndex];
+    // Retour de l'identifiant du candidat gagnant
+    return gagnantIndex;
 }
 
 // Fonction pour effectuer un vote uninominal à un tour
-VoteResult voteUninominalUnTour(DataFrame *df, FILE *log, bool debugMode, char *columnToSkip)
+VoteResult voteUninominalUnTour(DataFrame *df, CandidateTable *candidates, FILE *log, bool debugMode, int candidatToSkip)
 {
-    VoteResult result;
     int nbVotes;
-    strcpy(result.winner, gagnantUninominalUnTour(df, &nbVotes, columnToSkip));
+    int gagnant = gagnantUninominalUnTour(df, candidates, &nbVotes, candidatToSkip);
 
-    result.nb_candidates = df->num_columns - 4; // Nombre de candidats
-    result.nb_voters = df->num_rows;            // Nombre d'électeurs
-    result.score = nbVotes;    // score du gagnant
+    // Nombre de candidats, nombre d'électeurs et score du gagnant
+    VoteResult result = createVoteResult(candidates, df->num_rows, nbVotes, gagnant);
 
     // Ecriture des résultats dans le fichier de log
-    if (debugMode)
+    if (journalActif(debugMode, JOURNAL_RESULTATS))
     {
         fprintf(log, "Résultats du vote uninominal à un tour :\n");
-        fprintf(log, "Gagnant : %s\n", result.winner);
+        fprintf(log, "Gagnant : %s\n", candidateName(candidates, result.winner));
         fprintf(log, "Nombre de candidats : %d\n", result.nb_candidates);
         fprintf(log, "Nombre d'électeurs : %d\n", result.nb_voters);
         fprintf(log, "Score : %f\n", (result.score/result.nb_voters)*100);
@@ -100,88 +78,141 @@ VoteResult voteUninominalUnTour(DataFrame *df, FILE *log, bool debugMode, char *
     return result;
 }
 
-///====================================================================================
-///                                 UNINOMINAL 2 TOUR
-///====================================================================================
-
-char *preferenceCandidat(DataFrame *df, char *firstCandidate, char *secondCandidate, int *nbVotes)
+// Fonction auxiliaire pour trouver le gagnant d'un vote uninominal à un tour, en s'arrêtant
+// dès que l'avance du premier sur le deuxième dépasse le nombre de bulletins restants
+int gagnantUninominalUnTourAnticipe(DataFrame *df, CandidateTable *candidates, int *nbVotes, int *nbLus)
 {
-
-    int numCandidates = 2;
-    int votes[2] = {0, 0};
-
-    char *columns_names[df->num_columns];
-    getColumnsNames(df, columns_names);
-    Column reponses = dfSelect(df, columns_names[0]);
-
-    for (int i = 0; i < df->num_rows; i++)
+    int numCandidates = candidates->nb_candidates;
+    int votes[numCandidates + 1];
+    int *rangs[numCandidates + 1];
+    for (int c = 0; c < numCandidates; c++)
     {
-        char response[5];
-        sprintf(response, "%d", ((int *)reponses.data)[i]);
-        Series row = getRow(df, columns_names[0], response);
-        int scoreFirstCandidate = 0;
-        int scoreSecondCandidate = 0;
+        votes[c] = 0;
+        rangs[c] = (int *)df->columns[candidates->columns[c]].data;
+    }
 
-        for (int j = 0; j < df->num_columns; j++)
+    int gagnantIndex = 0;
+    int lus = 0;
+    while (lus < df->num_rows)
+    {
+        for (int c = 0; c < numCandidates; c++)
+            votes[c] += rangs[c][lus] == 1;
+        lus++;
+
+        // Un bulletin ne donne qu'une voix de plus à chaque candidat : l'écart ne peut baisser que d'une voix
+        gagnantIndex = 0;
+        int deuxieme = 0;
+        for (int c = 1; c < numCandidates; c++)
         {
-            Item item = row.items[j];
-            if (strcmp(firstCandidate, item.label) == 0)
-                scoreFirstCandidate = selectIntFromSeries(row, firstCandidate);
-            else if (strcmp(secondCandidate, item.label) == 0)
-                scoreSecondCandidate = selectIntFromSeries(row, secondCandidate);
+            if (votes[c] > votes[gagnantIndex])
+            {
+                deuxieme = votes[gagnantIndex];
+                gagnantIndex = c;
+            }
+            else if (votes[c] > deuxieme)
+                deuxieme = votes[c];
         }
-
-        if ((scoreFirstCandidate < scoreSecondCandidate) && (scoreFirstCandidate != -1))
-            votes[0] += 1;
-        else if ((scoreFirstCandidate > scoreSecondCandidate) && (scoreSecondCandidate != -1))
-            votes[1] += 1;
-        else
-            continue;
+        if (numCandidates > 1 && votes[gagnantIndex] - deuxieme > df->num_rows - lus)
+            break;
     }
 
-    if (votes[0] > votes[1])
+    *nbVotes = numCandidates > 0 ? votes[gagnantIndex] : 0;
+    *nbLus = lus;
+    return gagnantIndex;
+}
+
+// Fonction pour effectuer un vote uninominal à un tour avec arrêt anticipé
+VoteResult voteUninominalUnTourAnticipe(DataFrame *df, CandidateTable *candidates, FILE *log, bool debugMode)
+{
+    int nbVotes;
+    int nbLus;
+    int gagnant = gagnantUninominalUnTourAnticipe(df, candidates, &nbVotes, &nbLus);
+
+    VoteResult result = createVoteResult(candidates, df->num_rows, nbVotes, gagnant);
+    result.nb_read = nbLus;
+
+    // Ecriture des résultats dans le fichier de log
+    if (journalActif(debugMode, JOURNAL_RESULTATS))
     {
-        *nbVotes = votes[0];
-        return firstCandidate;
+        fprintf(log, "Résultats du vote uninominal à un tour (arrêt anticipé) :\n");
+        fprintf(log, "Gagnant : %s\n", candidateName(candidates, result.winner));
+        fprintf(log, "Nombre de candidats : %d\n", result.nb_candidates);
+        fprintf(log, "Nombre d'électeurs : %d\n", result.nb_voters);
+        fprintf(log, "Bulletins lus : %d\n", result.nb_read);
+        fprintf(log, "Voix du gagnant parmi les bulletins lus : %d\n", nbVotes);
+        fprintf(log, "Score parmi les bulletins lus : %f\n", (result.score / result.nb_read) * 100);
+        fprintf(log, "\n");
     }
-    else
+
+    return result;
+}
+
+///====================================================================================
+///                                 UNINOMINAL 2 TOUR
+///====================================================================================
+
+// Fonction auxiliaire qui classe les candidats par nombre de premières places décroissant
+// À égalité, le candidat de plus petit identifiant passe devant
+static void classerPremieresPlaces(const int *votes, int numCandidates, int *classement)
+{
+    for (int c = 0; c < numCandidates; c++)
     {
-        *nbVotes = votes[1];
-        return secondCandidate;
+        int p = c;
+        while (p > 0 && votes[classement[p - 1]] < votes[c])
+        {
+            classement[p] = classement[p - 1];
+            p--;
+        }
+        classement[p] = c;
     }
 }
 
-// Fonction pour effectuer un vote uninominal à deux tours
-void voteUninominalDeuxTours(DataFrame *df, FILE *log, bool debugMode, VoteResult *firstTourFirstCandidate,VoteResult *firstTourSecondCandidate,  VoteResult *secondTour, bool *majorite)
+// Fonction pour effectuer un vote uninominal à deux tours à partir d'un dépouillement déjà fait
+void voteUninominalDeuxToursDuels(DuelMatrix *duels, const int *premieresPlaces, CandidateTable *candidates, FILE *log, bool debugMode, VoteResult *firstTourFirstCandidate, VoteResult *firstTourSecondCandidate, VoteResult *secondTour, bool *majorite)
 {
-
-    *firstTourFirstCandidate = voteUninominalUnTour(df, log, debugMode, NULL);
+    int numCandidates = candidates->nb_candidates;
+    int nbVotants = duels->nb_ballots;
+    int classement[numCandidates + 1];
+    classerPremieresPlaces(premieresPlaces, numCandidates, classement);
+
+    // Premier tour : les deux candidats les mieux placés
+    int premier = numCandidates > 0 ? classement[0] : -1;
+    int second = numCandidates > 1 ? classement[1] : -1;
+    *firstTourFirstCandidate = createVoteResult(candidates, nbVotants, premier == -1 ? 0 : premieresPlaces[premier], premier);
+    *firstTourSecondCandidate = createVoteResult(candidates, nbVotants, second == -1 ? 0 : premieresPlaces[second], second);
+
+    // Ecriture des résultats du premier tour dans le fichier de log
+    if (journalActif(debugMode, JOURNAL_DETAILS))
+    {
+        fprintf(log, "Résultats du premier tour :\n");
+        for (int r = 0; r < numCandidates; r++)
+            fprintf(log, "%d. %s : %d voix\n", r + 1, candidates->names[classement[r]], premieresPlaces[classement[r]]);
+        fprintf(log, "Nombre d'électeurs : %d\n", nbVotants);
+    }
 
     // Vérifiez si le gagnant du premier tour a obtenu la majorité absolue
-    if (firstTourFirstCandidate->score > (float)(df->num_rows - 1) / 2.0)
+    *majorite = second == -1 || firstTourFirstCandidate->score > nbVotants / 2.0;
+    if (*majorite)
     {
         *secondTour = *firstTourFirstCandidate;
-        *majorite = true;
     }
     else
     {
-        // Création d'un DataFrame temporaire avec seulement les deux candidats les mieux placés
-        char *firstCandidate = firstTourFirstCandidate->winner;
-        *firstTourSecondCandidate = voteUninominalUnTour(df, log, debugMode, firstCandidate);
-        char *secondCandidate = firstTourSecondCandidate->winner;
-        int nbVotes;
-
+        // Le duel du second tour se lit directement dans la matrice des duels
+        int votesPremier = DUEL_WINS(duels, premier, second);
+        int votesSecond = DUEL_WINS(duels, second, premier);
+        // À égalité, la même règle qu'au premier tour : le candidat de plus petit identifiant l'emporte
+        bool premierGagne = votesPremier > votesSecond || (votesPremier == votesSecond && premier < second);
+        int gagnant = premierGagne ? premier : second;
+        *secondTour = createVoteResult(candidates, nbVotants, max(votesPremier, votesSecond), gagnant);
         secondTour->nb_candidates = 2;
-        secondTour->nb_voters = df->num_rows;
-        strcpy(secondTour->winner, preferenceCandidat(df, firstCandidate, secondCandidate, &nbVotes));
-        secondTour->score = nbVotes;
     }
-    
+
     // Ecriture des résultats du deuxième tour dans le fichier de log
-    if (debugMode)
+    if (journalActif(debugMode, JOURNAL_RESULTATS))
     {
         fprintf(log, "\nRésultats du deuxième tour :\n");
-        fprintf(log, "Gagnant : %s\n", secondTour->winner);
+        fprintf(log, "Gagnant : %s\n", candidateName(candidates, secondTour->winner));
         fprintf(log, "Nombre de candidats : %d\n", secondTour->nb_candidates);
         fprintf(log, "Nombre d'électeurs : %d\n", secondTour->nb_voters);
         fprintf(log, "Score : %f\n", ((secondTour->score)/(secondTour->nb_voters))*100);
@@ -189,4 +220,14 @@ void voteUninominalDeuxTours(DataFrame *df, FILE *log, bool debugMode, VoteResul
     }
 }
 
+// Fonction pour effectuer un vote uninominal à deux tours
+void voteUninominalDeuxTours(DataFrame *df, CandidateTable *candidates, FILE *log, bool debugMode, VoteResult *firstTourFirstCandidate,VoteResult *firstTourSecondCandidate,  VoteResult *secondTour, bool *majorite)
+{
+    // Un seul passage sur les bulletins donne les deux tours
+    int premieresPlaces[candidates->nb_candidates + 1];
+    DuelMatrix *duels = tallyBallots(df, candidates, premieresPlaces);
+    voteUninominalDeuxToursDuels(duels, premieresPlaces, candidates, log, debugMode, firstTourFirstCandidate, firstTourSecondCandidate, secondTour, majorite);
+    deleteDuelMatrix(duels);
+}
+
 #endif
\ No newline at end of file
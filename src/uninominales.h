@@ -3,6 +3,8 @@
 
 #include "lecture_csv.h"
 #include "utils.h"
+#include "candidats.h"
+#include "duels.h"
 #include <stdio.h>
 #include <stdbool.h>
 #include <stdlib.h>
@@ -18,27 +20,64 @@
  */
 
 /**
- * @fn VoteResult voteUninominalUnTour(DataFrame *df, FILE *log, bool debugMode);
+ * @fn VoteResult voteUninominalUnTour(DataFrame *df, CandidateTable *candidates, FILE *log, bool debugMode, int candidatToSkip);
  * @brief Fonction pour effectuer un vote uninominal à un tour.
  * @param[in] df Pointeur vers le DataFrame contenant les résultats du vote.
+ * @param[in] candidates Table des candidats.
  * @param[in] log Pointeur vers le fichier de test des sorties.
  * @param[in] debugMode Indique si le mode débogage est activé.
- * @param[in] columnToSkip Nom de la colonne à ignorer.
+ * @param[in] candidatToSkip Identifiant du candidat à ignorer, -1 pour n'en ignorer aucun.
  * @return Structure VoteResult contenant les résultats du vote uninominal à un tour.
  */
-VoteResult voteUninominalUnTour(DataFrame *df, FILE *log, bool debugMode, char *columnToSkip);
+VoteResult voteUninominalUnTour(DataFrame *df, CandidateTable *candidates, FILE *log, bool debugMode, int candidatToSkip);
 
 /**
- * @fn void voteUninominalDeuxTours(DataFrame *df, FILE *log, bool debugMode, VoteResult *firstTour, VoteResult *secondTour);
+ * @fn VoteResult voteUninominalUnTourAnticipe(DataFrame *df, CandidateTable *candidates, FILE *log, bool debugMode);
+ * @brief Fonction pour effectuer un vote uninominal à un tour, arrêté dès que le gagnant ne peut plus changer.
+ * @param[in] df Pointeur vers le DataFrame contenant les résultats du vote.
+ * @param[in] candidates Table des candidats.
+ * @param[in] log Pointeur vers le fichier de test des sorties.
+ * @param[in] debugMode Indique si le mode débogage est activé.
+ * @return Structure VoteResult contenant les résultats du vote, nb_read étant le nombre de bulletins lus.
+ *
+ * @note Le dépouillement s'arrête dès que l'avance du premier dépasse le nombre de bulletins restants.
+ *       Le score est alors celui obtenu sur les bulletins lus.
+ */
+VoteResult voteUninominalUnTourAnticipe(DataFrame *df, CandidateTable *candidates, FILE *log, bool debugMode);
+
+/**
+ * @fn void voteUninominalDeuxTours(DataFrame *df, CandidateTable *candidates, FILE *log, bool debugMode, VoteResult *firstTourFirstCandidate, VoteResult *firstTourSecondCandidate, VoteResult *secondTour, bool *majorite);
  * @brief Fonction pour effectuer un vote uninominal à deux tours.
  * @param[in] df Pointeur vers le DataFrame contenant les résultats du vote.
+ * @param[in] candidates Table des candidats.
+ * @param[in] log Pointeur vers le fichier de test des sorties.
+ * @param[in] debugMode Indique si le mode débogage est activé.
+ * @param[out] firstTourFirstCandidate Résultats du premier tour de vote, concernant le premier candidat.
+ * @param[out] firstTourSecondCandidate Résultats du premier tour de vote, concernant le deuxième candidat.
+ * @param[out] secondTour Résultats du deuxième tour de vote.
+ * @param[out] majorite Indique si la majorité est gagnée.
+ *
+ * @note Les bulletins ne sont lus qu'une fois : les premières places donnent le premier tour,
+ *       la matrice des duels donne directement le second tour.
+ */
+void voteUninominalDeuxTours(DataFrame *df, CandidateTable *candidates, FILE *log, bool debugMode, VoteResult *firstTourFirstCandidate,VoteResult *firstTourSecondCandidate,  VoteResult *secondTour, bool *majorite);
+
+/**
+ * @fn void voteUninominalDeuxToursDuels(DuelMatrix *duels, const int *premieresPlaces, CandidateTable *candidates, FILE *log, bool debugMode, VoteResult *firstTourFirstCandidate, VoteResult *firstTourSecondCandidate, VoteResult *secondTour, bool *majorite);
+ * @brief Fonction pour effectuer un vote uninominal à deux tours à partir d'un dépouillement déjà fait.
+ * @param[in] duels Matrice des duels.
+ * @param[in] premieresPlaces Nombre de premières places de chaque candidat.
+ * @param[in] candidates Table des candidats.
  * @param[in] log Pointeur vers le fichier de test des sorties.
  * @param[in] debugMode Indique si le mode débogage est activé.
  * @param[out] firstTourFirstCandidate Résultats du premier tour de vote, concernant le premier candidat.
  * @param[out] firstTourSecondCandidate Résultats du premier tour de vote, concernant le deuxième candidat.
  * @param[out] secondTour Résultats du deuxième tour de vote.
  * @param[out] majorite Indique si la majorité est gagnée.
+ *
+ * @note À égalité de premières places, le candidat de plus petit identifiant est qualifié ;
+ *       à égalité au second tour, le candidat de plus petit identifiant est élu.
  */
-void voteUninominalDeuxTours(DataFrame *df, FILE *log, bool debugMode, VoteResult *firstTourFirstCandidate,VoteResult *firstTourSecondCandidate,  VoteResult *secondTour, bool *majorite);
+void voteUninominalDeuxToursDuels(DuelMatrix *duels, const int *premieresPlaces, CandidateTable *candidates, FILE *log, bool debugMode, VoteResult *firstTourFirstCandidate, VoteResult *firstTourSecondCandidate, VoteResult *secondTour, bool *majorite);
 
 #endif
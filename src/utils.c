@@ -12,78 +12,113 @@
 #define UTILS_C
 
 #include "utils.h"
-#include <stdarg.h>
 
 /////////////////////
 // -- Fonctions -- //
 /////////////////////
 
 /**
- * @fn void printResult(VoteResult result, char *method, int tour)
- * @brief Fonction pour afficher les résultats d'un vote.
+ * @fn void fprintResult(FILE *out, VoteResult result, char *method, int tour)
+ * @brief Fonction pour écrire les résultats d'un vote dans un fichier.
+ * @param[out] out Fichier de sortie.
  * @param[in] result Structure contenant les données du vote.
  * @param[in] method Mode de scrutin.
  * @param[in] tour Tour du vote, si uninominal.
  *
- * @note L'affichage est base sur le mode de scrutin.
+ * @note L'affichage est base sur le mode de scrutin. Les pourcentages sont rapportés aux bulletins lus.
  */
-void printResult(VoteResult result, char *method, int tour)
+void fprintResult(FILE *out, VoteResult result, char *method, int tour)
 {
-    printf("Mode de scrutin : ");
+    fprintf(out, "Mode de scrutin : ");
 
     if (strcmp(method, "uni1") == 0)
     {
-        printf("uninominal à un tour, tour %d", tour);
+        fprintf(out, "uninominal à un tour, tour %d", tour);
     }
     else if (strcmp(method, "uni2") == 0)
     {
-        printf("uninominal à deux tours, tour %d", tour);
+        fprintf(out, "uninominal à deux tours, tour %d", tour);
     }
     else if (strcmp(method, "cm") == 0)
     {
-        printf("Condorcet minimax");
+        fprintf(out, "Condorcet minimax");
+    }
+    else if (strcmp(method, "cmv") == 0)
+    {
+        fprintf(out, "Condorcet minimax par votes gagnants");
+    }
+    else if (strcmp(method, "cmo") == 0)
+    {
+        fprintf(out, "Condorcet minimax par opposition");
     }
     else if (strcmp(method, "cp") == 0)
     {
-        printf("Condorcet paires");
+        fprintf(out, "Condorcet paires");
     }
     else if (strcmp(method, "cs") == 0)
     {
-        printf("Condorcet Schulze");
+        fprintf(out, "Condorcet Schulze");
     }
     else if (strcmp(method, "jm") == 0)
     {
-        printf("jugement majoritaire");
+        fprintf(out, "jugement majoritaire");
+    }
+    else if (strcmp(method, "irv") == 0)
+    {
+        fprintf(out, "vote alternatif");
+    }
+    else if (strcmp(method, "stv") == 0)
+    {
+        fprintf(out, "vote unique transférable, siège %d", tour);
+    }
+    else if (strcmp(method, "borda") == 0)
+    {
+        fprintf(out, "Borda");
+    }
+    else if (strcmp(method, "dowdall") == 0)
+    {
+        fprintf(out, "Dowdall");
+    }
+    else if (strcmp(method, "anti") == 0)
+    {
+        fprintf(out, "anti-pluralité");
+    }
+    else if (strcmp(method, "bucklin") == 0)
+    {
+        fprintf(out, "Bucklin, tour %d", tour);
     }
 
-    printf(", %d candidats, %d votants, vainqueur = %s", result.nb_candidates, result.nb_voters, result.winner);
+    fprintf(out, ", %d candidats, %d votants, vainqueur = %s", result.nb_candidates, result.nb_voters, candidateName(result.candidates, result.winner));
+
+    if (strcmp(method, "uni1") == 0 || strcmp(method, "uni2") == 0 || strcmp(method, "irv") == 0 || strcmp(method, "stv") == 0 || strcmp(method, "bucklin") == 0)
+    {
+        // En cas d'arrêt anticipé, les voix du vainqueur ne sont comptées que sur les bulletins lus
+        float score_percentage = (result.score / result.nb_read) * 100;
+        fprintf(out, ", score = %.2f%%", score_percentage);
+    }
+    else if (strcmp(method, "borda") == 0 || strcmp(method, "dowdall") == 0 || strcmp(method, "anti") == 0)
+    {
+        fprintf(out, ", score = %.2f points", result.score);
+    }
 
-    if (strcmp(method, "uni1") == 0 || strcmp(method, "uni2") == 0)
+    if (result.nb_read < result.nb_voters)
     {
-        float score_percentage = (result.score / result.nb_voters) * 100;
-        printf(", score = %.2f%%", score_percentage);
+        fprintf(out, ", bulletins lus = %d", result.nb_read);
     }
 
-    printf("\n");
+    fprintf(out, "\n");
 }
 
 /**
- * @fn void logprintf(FILE *log, bool debugMode, char *message, ...)
- * @brief Fonction pour afficher les messages de debug.
- * @param[in] log Fichier de log.
- * @param[in] debugMode Mode de debug.
- * @param[in] message Message à afficher.
- * @param[in] ... Arguments du message.
+ * @fn void printResult(VoteResult result, char *method, int tour)
+ * @brief Fonction pour afficher les résultats d'un vote.
+ * @param[in] result Structure contenant les données du vote.
+ * @param[in] method Mode de scrutin.
+ * @param[in] tour Tour du vote, si uninominal.
  */
-void logprintf(FILE *log, bool debugMode, char *message, ...)
+void printResult(VoteResult result, char *method, int tour)
 {
-    if (debugMode)
-    {
-        va_list args;
-        va_start(args, message);
-        vfprintf(log, message, args);
-        va_end(args);
-    }
+    fprintResult(stdout, result, method, tour);
 }
 
 /**
@@ -123,21 +158,23 @@ void getIdxsCandidats(DataFrame *df, int nb_candidates, int *idxs_candidats)
 }
 
 /**
- * @fn createVoteResult(int nb_candidates, int nb_voters, int score, char *winner)
+ * @fn createVoteResult(CandidateTable *candidates, int nb_voters, float score, int winner)
  * @brief Fonction pour créer une structure VoteResult.
- * @param[in] nb_candidates Nombre de candidats.
+ * @param[in] candidates Table des candidats.
  * @param[in] nb_voters Nombre de votants.
  * @param[in] score Score du vainqueur.
- * @param[in] winner Vainqueur.
+ * @param[in] winner Identifiant du vainqueur.
  * @return Structure VoteResult.
  */
-VoteResult createVoteResult(int nb_candidates, int nb_voters, int score, char *winner)
+VoteResult createVoteResult(CandidateTable *candidates, int nb_voters, float score, int winner)
 {
     VoteResult res;
-    res.nb_candidates = nb_candidates;
+    res.nb_candidates = candidates->nb_candidates;
     res.nb_voters = nb_voters;
+    res.nb_read = nb_voters;
     res.score = score;
-    strcpy(res.winner, winner);
+    res.winner = winner;
+    res.candidates = candidates;
     return res;
 }
 
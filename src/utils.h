@@ -15,6 +15,8 @@
 #include <stdlib.h>
 #include <string.h>
 #include "lecture_csv.h"
+#include "candidats.h"
+#include "journal.h"
 
 /////////////////////////////////
 // -- Structures de données -- //
@@ -24,8 +26,10 @@ typedef struct VoteResult
 {
     int nb_candidates;
     int nb_voters;
+    int nb_read;                ///< Nombre de bulletins effectivement lus, inférieur à nb_voters en cas d'arrêt anticipé.
     float score;
-    char winner[MAXCHAR];
+    int winner;                 ///< Identifiant du vainqueur, -1 si aucun.
+    CandidateTable *candidates; ///< Table servant à résoudre le nom du vainqueur à l'affichage.
 } VoteResult;
 
 /////////////////////
@@ -44,14 +48,14 @@ typedef struct VoteResult
 void printResult(VoteResult result, char *method, int tour);
 
 /**
- * @fn void logprintf(FILE *log, bool debugMode, char *message, ...)
- * @brief Fonction pour afficher les messages de debug.
- * @param[in] log Fichier de log.
- * @param[in] debugMode Mode de debug.
- * @param[in] message Message à afficher.
- * @param[in] ... Arguments du message.
+ * @fn void fprintResult(FILE *out, VoteResult result, char *method, int tour)
+ * @brief Fonction pour écrire les résultats d'un vote dans un fichier, au même format que printResult.
+ * @param[out] out Fichier de sortie.
+ * @param[in] result Structure contenant les données du vote.
+ * @param[in] method Mode de scrutin.
+ * @param[in] tour Tour du vote, si uninominal.
  */
-void logprintf(FILE *log, bool debugMode, char *message, ...);
+void fprintResult(FILE *out, VoteResult result, char *method, int tour);
 
 /**
  * @fn getNbCandidat(DataFrame *df)
@@ -71,15 +75,15 @@ int getNbCandidat(DataFrame *df);
 void getIdxsCandidats(DataFrame *df, int nb_candidates, int *idxs_candidats);
 
 /**
- * @fn createVoteResult(int nb_candidates, int nb_voters, int score, char *winner)
+ * @fn createVoteResult(CandidateTable *candidates, int nb_voters, float score, int winner)
  * @brief Fonction pour créer une structure VoteResult.
- * @param[in] nb_candidates Nombre de candidats.
+ * @param[in] candidates Table des candidats.
  * @param[in] nb_voters Nombre de votants.
  * @param[in] score Score du vainqueur.
- * @param[in] winner Vainqueur.
+ * @param[in] winner Identifiant du vainqueur.
  * @return Structure VoteResult.
  */
-VoteResult createVoteResult(int nb_candidates, int nb_voters, int score, char *winner);
+VoteResult createVoteResult(CandidateTable *candidates, int nb_voters, float score, int winner);
 
 /**
  * @fn max(int a, int b)
@@ -66,6 +66,7 @@ void getHash(DataFrame *df_codes,
     toUpperCase(nom);
     toCamelCase(prenom);
     snprintf(nom_complet, sizeof(nom_complet), "%s %s%s", nom, prenom, code_perso);
+    freeSeries(infosEtu);
     sha256ofString(nom_complet, hash_res);
 }
 
@@ -99,6 +100,11 @@ int main(int argc, char *argv[])
 
     DataFrame *df_codes = createDataFrameFromCsv("../data/codeCondorcetNumEtu.csv");
     DataFrame *df_res_votes = createDataFrameFromCsv("../data/VoteCondorcet.csv");
+    if (df_codes == NULL || df_res_votes == NULL)
+    {
+        fprintf(stderr, "Erreur : %s.\n", erreurLecture());
+        exit(EXIT_FAILURE);
+    }
     char hash_res[SHA256_BLOCK_SIZE * 2 + 1];
     getHash(df_codes, num_etu, nom, prenom, hash_res);
 
@@ -110,7 +116,11 @@ int main(int argc, char *argv[])
         Series vote_details = getRow(df_res_votes, "Nom complet", hash_res);
         printf("Voici les détails de votre vote :\n\n");
         printSeries(vote_details);
+        freeSeries(vote_details);
     }
 
+    freeDataFrame(df_codes);
+    freeDataFrame(df_res_votes);
+
     return 0;
 }